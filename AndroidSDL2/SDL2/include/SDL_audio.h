@@ -489,6 +489,111 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ *  \name WAVE streaming
+ *
+ *  A WAVE stream decodes the data of a WAVE file on demand instead of loading
+ *  all of it into memory. Only the headers are parsed when the stream is
+ *  opened; the data chunk is then read and decoded block by block as the
+ *  application asks for it. The decoded data is identical to what
+ *  SDL_LoadWAV_RW() returns for the same file and the same hints.
+ */
+/* @{ */
+
+struct SDL_WAVStream;
+typedef struct SDL_WAVStream SDL_WAVStream;
+
+/**
+ *  \brief Open a WAVE file for streaming
+ *
+ *  The same formats and hints as with SDL_LoadWAV_RW() are supported. On
+ *  success, the \ref SDL_AudioSpec pointed to by \c spec is filled in the
+ *  same way SDL_LoadWAV_RW() does it.
+ *
+ *  If \c freesrc is non-zero, the data source is closed when the stream is
+ *  closed, or right away if opening the stream fails. Otherwise, the data
+ *  source must stay valid until the stream is closed and must not be used
+ *  by anything else in the meantime. It is required that the data source
+ *  supports seeking.
+ *
+ *  \param src The data source with the WAVE data
+ *  \param freesrc A integer value that makes the stream close the data source if non-zero
+ *  \param spec A pointer filled with the audio format of the decoded data
+ *  \return A new stream, or NULL on error.
+ *
+ *  \sa SDL_ReadWAVStream
+ *  \sa SDL_CloseWAVStream
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec * spec);
+
+/**
+ *  Opens a WAV file for streaming.
+ */
+#define SDL_OpenWAVStream(file, spec) \
+    SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"),1, spec)
+
+/**
+ *  \brief Decode the next audio data of a WAVE stream
+ *
+ *  Only whole sample frames are returned, so \c len should be at least one
+ *  frame in size. Compressed formats are decoded one block at a time and only
+ *  the block currently being read is kept in memory.
+ *
+ *  A truncated data chunk is treated according to SDL_HINT_WAVE_TRUNCATION
+ *  when the stream runs into it.
+ *
+ *  \param stream The stream to decode from
+ *  \param buf A buffer to fill with the decoded audio data
+ *  \param len The size of the buffer in bytes
+ *  \return The number of bytes written to \c buf, 0 at the end of the data,
+ *          or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWAVStream(SDL_WAVStream * stream,
+                                              void * buf, int len);
+
+/**
+ *  \brief Set the sample frame the next SDL_ReadWAVStream() starts at
+ *
+ *  Compressed formats can only be decoded from the start of a block, so the
+ *  stream decodes the block containing \c frame and skips to the frame from
+ *  there. Seeking does not do any I/O until the next read.
+ *
+ *  \param stream The stream to seek in
+ *  \param frame The sample frame to seek to, clamped to the stream length
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_WAVStream * stream,
+                                              Sint64 frame);
+
+/**
+ *  \brief Get the sample frame the next SDL_ReadWAVStream() starts at
+ *
+ *  \return The sample frame position, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_TellWAVStream(SDL_WAVStream * stream);
+
+/**
+ *  \brief Get the length of a WAVE stream in sample frames
+ *
+ *  The length comes from the headers. It shrinks if the stream later runs
+ *  into a truncated data chunk.
+ *
+ *  \return The number of sample frames, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_GetWAVStreamLength(SDL_WAVStream * stream);
+
+/**
+ *  \brief Close a WAVE stream
+ *
+ *  If the stream was opened with \c freesrc set to zero, the data source is
+ *  left positioned after the end of the WAVE data.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+
+/* @} *//* WAVE streaming */
+
 /**
  *  This function takes a source format and rate and a destination format
  *  and rate, and initializes the \c cvt structure with information needed
@@ -667,6 +772,140 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ *  \name Voice mixer
+ *
+ *  A voice mixer plays any number of preloaded sounds on an audio device at
+ *  once, each with its own gain, pan and pitch.  Calls from other threads
+ *  reach the audio thread through a lock-free command queue, so starting or
+ *  stopping a sound never waits for the audio callback to finish.
+ */
+/* @{ */
+typedef struct SDL_VoiceMixer SDL_VoiceMixer;
+typedef struct SDL_MixerSound SDL_MixerSound;
+
+/**
+ *  A voice playing a sound on a voice mixer.  Zero is never a valid voice.
+ */
+typedef Uint32 SDL_VoiceID;
+
+/**
+ *  Statistics a voice mixer keeps about its audio callback.
+ */
+typedef struct SDL_VoiceMixerStats
+{
+    Uint32 callbacks;           /**< Number of buffers mixed so far */
+    Uint32 glitches;            /**< Buffers that took longer to mix than to play */
+    Uint32 active_voices;       /**< Voices still playing after the last buffer */
+    Uint32 dropped_voices;      /**< Sounds not played because every voice was busy */
+    Uint32 dropped_commands;    /**< Calls lost because the command queue was full */
+    Uint32 buffer_us;           /**< Playing time of one buffer, in microseconds */
+    Uint32 last_mix_us;         /**< Time spent mixing the last buffer, in microseconds */
+    Uint32 max_mix_us;          /**< Longest time spent mixing a buffer, in microseconds */
+    Uint32 average_mix_us;      /**< Average time spent mixing a buffer, in microseconds */
+} SDL_VoiceMixerStats;
+
+/**
+ *  Open an audio device and mix up to \c max_voices sounds into it.
+ *
+ *  The frequency, channels and samples of \c desired are used as in
+ *  SDL_OpenAudioDevice(); the format and callback are ignored, as the mixer
+ *  works in float and SDL converts to whatever the hardware wants.  Mono
+ *  and stereo devices get panning; on devices with more channels, voices
+ *  play on the front left and right channels.
+ *
+ *  Like any other device, the mixer's device starts paused, so call
+ *  SDL_PauseAudioDevice(SDL_GetVoiceMixerDevice(mixer), 0) to start it.
+ *
+ *  \return The new mixer, or NULL on error.
+ *
+ *  \sa SDL_CloseVoiceMixer
+ */
+extern DECLSPEC SDL_VoiceMixer *SDLCALL SDL_OpenVoiceMixer(const char *device,
+                                                           const SDL_AudioSpec *desired,
+                                                           int max_voices);
+
+/**
+ *  Get the audio device a voice mixer plays on.
+ */
+extern DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetVoiceMixerDevice(SDL_VoiceMixer *mixer);
+
+/**
+ *  Close a voice mixer's audio device, and free the mixer and every sound
+ *  created on it.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseVoiceMixer(SDL_VoiceMixer *mixer);
+
+/**
+ *  Load a sound into a voice mixer.
+ *
+ *  The audio in \c buf, described by \c spec, is copied and converted to
+ *  float, keeping its frequency.  Sounds with more than two channels are
+ *  mixed down to stereo.
+ *
+ *  \return The new sound, or NULL on error.
+ */
+extern DECLSPEC SDL_MixerSound *SDLCALL SDL_CreateMixerSound(SDL_VoiceMixer *mixer,
+                                                             const SDL_AudioSpec *spec,
+                                                             const Uint8 *buf,
+                                                             Uint32 len);
+
+/**
+ *  Free a sound.  Voices already playing it carry on to the end, and the
+ *  memory is released once the last of them has finished.
+ */
+extern DECLSPEC void SDLCALL SDL_FreeMixerSound(SDL_MixerSound *sound);
+
+/**
+ *  Start playing a sound on a free voice.
+ *
+ *  \param sound The sound to play.
+ *  \param gain The volume, where 1.0 plays the sound as it is.
+ *  \param pan The position from -1.0 (left) to 1.0 (right).
+ *  \param pitch The playback speed, where 1.0 plays the sound as it is.
+ *  \param loops How many more times to play the sound, or -1 to repeat it
+ *               until it's stopped.
+ *  \return The new voice, or 0 on error.
+ *
+ *  The sound starts at the mixer's next audio callback.  If every voice is
+ *  busy by then, it doesn't play and SDL_VoiceMixerStats::dropped_voices
+ *  goes up.  This function is thread-safe and doesn't block.
+ */
+extern DECLSPEC SDL_VoiceID SDLCALL SDL_PlayMixerSound(SDL_MixerSound *sound,
+                                                       float gain, float pan,
+                                                       float pitch, int loops);
+
+/**
+ *  Change the gain, pan and pitch of a playing voice.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetVoiceParams(SDL_VoiceMixer *mixer,
+                                               SDL_VoiceID voice,
+                                               float gain, float pan,
+                                               float pitch);
+
+/**
+ *  Stop a voice.  Stopping a voice that has already finished does nothing.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_StopVoice(SDL_VoiceMixer *mixer, SDL_VoiceID voice);
+
+/**
+ *  Stop every voice of a voice mixer.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_StopAllVoices(SDL_VoiceMixer *mixer);
+
+/**
+ *  Get the statistics of a voice mixer.
+ */
+extern DECLSPEC void SDLCALL SDL_GetVoiceMixerStats(SDL_VoiceMixer *mixer,
+                                                    SDL_VoiceMixerStats *stats);
+/* @} *//* Voice mixer */
+
 /**
  *  Queue more audio on non-callback devices.
  *
@@ -196,6 +196,35 @@ extern DECLSPEC SDL_bool SDLCALL SDL_HasARMSIMD(void);
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_HasNEON(void);
 
+/**
+ *  This function returns the number of kernel families (blitters, fills,
+ *  audio converters and so on) that SDL picks a SIMD implementation for at
+ *  runtime.
+ */
+extern DECLSPEC int SDLCALL SDL_GetNumCPUDispatchKernels(void);
+
+/**
+ *  This function returns the name of a kernel family, like "blit.alpha" or
+ *  "audio.convert", or NULL if the index is out of range.
+ *
+ *  \sa SDL_GetNumCPUDispatchKernels()
+ */
+extern DECLSPEC const char * SDLCALL SDL_GetCPUDispatchKernel(int index);
+
+/**
+ *  This function returns the instruction set SDL uses for a kernel family,
+ *  like "AVX2", "SSE2" or "NEON", or "C" if it uses the portable code. This
+ *  takes the CPU, the instruction sets SDL was built with and
+ *  SDL_HINT_CPU_FEATURE_MASK into account. Pixel formats and audio formats
+ *  without a kernel for that instruction set still fall back to a lesser one.
+ *
+ *  \return The name of the instruction set, or NULL if the index is out of
+ *          range.
+ *
+ *  \sa SDL_GetNumCPUDispatchKernels()
+ */
+extern DECLSPEC const char * SDLCALL SDL_GetCPUDispatchImplementation(int index);
+
 /**
  *  This function returns the amount of RAM configured in the system, in MB.
  */
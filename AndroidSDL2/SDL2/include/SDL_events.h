@@ -666,6 +666,21 @@ extern DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
  */
 extern DECLSPEC int SDLCALL SDL_PollEvent(SDL_Event * event);
 
+/**
+ *  \brief Polls for many pending events at once.
+ *
+ *  This pumps the event loop once, then removes up to \c maxevents events
+ *  from the front of the queue, in the same order SDL_PollEvent() would
+ *  return them.
+ *
+ *  \return The number of events stored in \c events, or -1 if there was an
+ *          error.
+ *
+ *  \param events    An array of at least \c maxevents events.
+ *  \param maxevents The maximum number of events to store.
+ */
+extern DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event * events, int maxevents);
+
 /**
  *  \brief Waits indefinitely for the next available event.
  *
@@ -1146,6 +1146,24 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_CATEGORY   "SDL_AUDIO_CATEGORY"
 
+/**
+ *  \brief  A variable controlling how audio queued with SDL_QueueAudio() is stored.
+ *
+ *  By default, queued audio is kept in a list of packets that grows as
+ *  needed, and the app and the audio thread take turns with the device lock
+ *  to use it.
+ *
+ *  If this is set to a size in bytes, devices opened for queueing use a
+ *  fixed ring buffer of that size instead (rounded up to a power of two, and
+ *  at least two device buffers).  Then SDL_QueueAudio() and
+ *  SDL_DequeueAudio() never take the device lock or allocate memory, but
+ *  queueing more than fits fails instead of growing the queue.  Only one
+ *  thread may queue (or dequeue) on a device at a time with the ring buffer.
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_QUEUE_RING_SIZE   "SDL_AUDIO_QUEUE_RING_SIZE"
+
 /**
  *  \brief  A variable controlling whether the 2D render API is compatible or efficient.
  *
@@ -1170,6 +1188,23 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer uses to execute its command queue.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Execute all render commands on the calling thread (default)
+ *    "N"        - Split the target into tiles and rasterize them on N threads
+ *
+ *  When more than one thread is requested, the software renderer bins the
+ *  queued commands into screen tiles and rasterizes each tile with its own
+ *  clip rectangle. The output is identical to serial execution; commands that
+ *  can't be split exactly (lines, scaled and rotated copies) are executed on
+ *  the calling thread between the parallel passes.
+ *
+ *  This hint is read when the renderer is created.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS  "SDL_RENDER_SOFTWARE_THREADS"
+
 
 /**
  *  \brief  A variable controlling whether SDL logs all events pushed onto its internal queue.
@@ -1192,6 +1227,25 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING   "SDL_EVENT_LOGGING"
 
+/**
+ *  \brief  A variable controlling whether consecutive motion events are merged in the event queue.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Every motion event is queued separately (default)
+ *    "1"     - A mouse or finger motion event is merged into the event at the
+ *              end of the queue if that is a motion event for the same window,
+ *              device and finger. The merged event has the newest position and
+ *              the sum of the relative motion.
+ *
+ *  High polling rate mice and touch screens can report motion many times per
+ *  frame. Merging those events keeps the queue short when the application only
+ *  cares about where the pointer ended up and how far it moved.
+ *
+ *  This hint can be toggled on and off at runtime.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION   "SDL_EVENT_COALESCE_MOTION"
+
 
 
 /**
@@ -1272,6 +1326,34 @@ extern "C" {
  */
 #define SDL_HINT_DISPLAY_USABLE_BOUNDS "SDL_DISPLAY_USABLE_BOUNDS"
 
+/**
+ *  \brief  A variable limiting the instruction sets SDL's own SIMD kernels may use.
+ *
+ *  This variable is a comma separated list of instruction sets, named like
+ *  the SDL_Has*() functions: "MMX", "3DNow", "SSE", "SSE2", "SSE3", "SSE4.1",
+ *  "SSE4.2", "AVX", "AVX2", "AVX512F", "NEON", "ARMSIMD" and "AltiVec". Each
+ *  x86 entry also allows the ones before it, so "SSE2" caps SDL at SSE2 and
+ *  "C" (or any other name SDL doesn't know) makes it use its portable code.
+ *
+ *  By default SDL uses everything the CPU has. This only changes which
+ *  blitters, fills, scalers and audio converters SDL picks; the SDL_Has*()
+ *  functions keep reporting the real CPU. SDL_GetCPUDispatchImplementation()
+ *  reports the result.
+ *
+ *  This hint is read once, the first time SDL picks a SIMD kernel, so set it
+ *  before calling SDL_Init().
+ */
+#define SDL_HINT_CPU_FEATURE_MASK "SDL_CPU_FEATURE_MASK"
+
+/**
+ *  \brief  A variable setting how many threads serve asynchronous reads.
+ *
+ *  The threads are shared by all SDL_AsyncIOQueue objects. They are started
+ *  when the first queue is created, so set this before that. The default is
+ *  4, and values are limited to 1 through 64.
+ */
+#define SDL_HINT_ASYNCIO_THREADS "SDL_ASYNCIO_THREADS"
+
 /**
  *  \brief  An enumeration of hint priorities
  */
@@ -125,6 +125,17 @@ typedef enum
     SDL_FLIP_VERTICAL = 0x00000002     /**< flip vertically */
 } SDL_RendererFlip;
 
+/**
+ *  \brief A single copy for SDL_RenderCopyBatch()
+ */
+typedef struct SDL_RenderCopyItem
+{
+    SDL_Rect srcrect;           /**< The source rectangle, or an empty rectangle for the entire texture */
+    SDL_FRect dstrect;          /**< The destination rectangle */
+    double angle;               /**< Degrees to rotate dstrect clockwise around its center */
+    SDL_RendererFlip flip;      /**< The flipping to apply to the texture */
+} SDL_RenderCopyItem;
+
 /**
  *  \brief A structure representing rendering state
  */
@@ -137,6 +148,12 @@ typedef struct SDL_Renderer SDL_Renderer;
 struct SDL_Texture;
 typedef struct SDL_Texture SDL_Texture;
 
+/**
+ *  \brief A recorded sequence of rendering commands that can be replayed
+ */
+struct SDL_RenderList;
+typedef struct SDL_RenderList SDL_RenderList;
+
 
 /* Function prototypes */
 
@@ -1037,6 +1054,24 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyExF(SDL_Renderer * renderer,
                                             const SDL_FPoint *center,
                                             const SDL_RendererFlip flip);
 
+/**
+ *  \brief Copy many portions of one texture to the current rendering target.
+ *
+ *  This draws the same thing as calling SDL_RenderCopyExF() for each item in
+ *  order, with a NULL center, but queues them all as a single draw.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param items    An array of copies to perform.
+ *  \param count    The number of copies.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyBatch(SDL_Renderer * renderer,
+                                                SDL_Texture * texture,
+                                                const SDL_RenderCopyItem * items,
+                                                int count);
+
 /**
  *  \brief Read pixels from the current rendering target.
  *
@@ -1103,6 +1138,68 @@ extern DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer * renderer);
  */
 extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
 
+/**
+ *  \brief Start recording rendering commands into a new render list.
+ *
+ *  Until SDL_RenderEndList() is called, the draw calls made on this renderer
+ *  are recorded instead of being drawn. Changing the viewport, clip rect,
+ *  draw color and blend mode is recorded along with them.
+ *
+ *  \param renderer The renderer to record.
+ *
+ *  \return 0 on success, or -1 on error
+ *
+ *  \sa SDL_RenderEndList()
+ *  \sa SDL_RenderReplayList()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderBeginList(SDL_Renderer * renderer);
+
+/**
+ *  \brief Stop recording rendering commands.
+ *
+ *  \param renderer The renderer that is recording.
+ *
+ *  \return The recorded render list, or NULL on error.
+ *
+ *  \sa SDL_RenderBeginList()
+ *  \sa SDL_DestroyRenderList()
+ */
+extern DECLSPEC SDL_RenderList * SDLCALL SDL_RenderEndList(SDL_Renderer * renderer);
+
+/**
+ *  \brief Draw a recorded render list to the current rendering target.
+ *
+ *  The recorded commands and vertex data are queued again as they are,
+ *  without being processed by the renderer a second time. The recorded
+ *  viewports are moved by the offset, so everything in the list, including
+ *  the clip rect, is drawn shifted by it.
+ *
+ *  The rendering state afterwards is the same as before the call. Recorded
+ *  copies of a texture that has since been destroyed are skipped.
+ *
+ *  \param renderer The renderer the list was recorded with.
+ *  \param list     The render list to draw.
+ *  \param x        The horizontal offset, in rendering coordinates.
+ *  \param y        The vertical offset, in rendering coordinates.
+ *
+ *  \return 0 on success, or -1 on error
+ *
+ *  \note The viewport and scale in effect when the list is replayed are not
+ *        applied to it, only the ones that were recorded.
+ */
+extern DECLSPEC int SDLCALL SDL_RenderReplayList(SDL_Renderer * renderer,
+                                                 SDL_RenderList * list,
+                                                 int x, int y);
+
+/**
+ *  \brief Destroy a render list.
+ *
+ *  This can be called after the renderer has been destroyed.
+ *
+ *  \sa SDL_RenderEndList()
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyRenderList(SDL_RenderList * list);
+
 
 /**
  *  \brief Bind the texture to the current OpenGL/ES/ES2 context for use with
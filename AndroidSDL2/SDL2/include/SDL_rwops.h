@@ -45,6 +45,7 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3U  /**< Android asset */
 #define SDL_RWOPS_MEMORY    4U  /**< Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5U  /**< Read-Only memory stream */
+#define SDL_RWOPS_MAPPED    6U  /**< Read-Only memory-mapped file */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -165,6 +166,39 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ *  Open a file for reading by mapping it into memory.
+ *
+ *  Reads are copies straight out of the mapping, and SDL_RWGetMemory()
+ *  gives direct access to the whole file, so data can be parsed in place
+ *  without being copied at all. Pages are loaded as they are touched.
+ *
+ *  If the file can't be mapped (Android assets, pipes, platforms without
+ *  support), it is read into memory instead, and the stream behaves the
+ *  same way.
+ *
+ *  The stream is read-only. The file must not be truncated while the
+ *  stream is open.
+ *
+ *  \return the new stream, or NULL if the file couldn't be opened.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMappedFile(const char *file);
+
+/**
+ *  Get direct access to the data of a memory-backed stream.
+ *
+ *  This works on streams from SDL_RWFromMem(), SDL_RWFromConstMem() and
+ *  SDL_RWFromMappedFile(). The pointer is to the start of the data, no
+ *  matter where the stream is positioned, and stays valid until the stream
+ *  is closed.
+ *
+ *  If \c size is not NULL, it is filled with the size of the data.
+ *
+ *  \return the data, or NULL if the stream isn't backed by memory.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetMemory(SDL_RWops *context,
+                                                    size_t *size);
+
 /* @} *//* RWFrom functions */
 
 
@@ -250,6 +284,165 @@ extern DECLSPEC void *SDLCALL SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize,
  */
 extern DECLSPEC void *SDLCALL SDL_LoadFile(const char *file, size_t *datasize);
 
+/**
+ *  \name Asynchronous reads
+ *
+ *  Reads that run on a pool of I/O threads, so loading doesn't block the
+ *  calling thread. Results are collected from a completion queue, either
+ *  by polling it or when an event says one is ready.
+ */
+/* @{ */
+
+typedef struct SDL_AsyncIOQueue SDL_AsyncIOQueue;
+
+/**
+ *  Identifies a request on its queue. Never 0.
+ */
+typedef Uint32 SDL_AsyncIOID;
+
+typedef enum
+{
+    SDL_ASYNCIO_PRIORITY_LOW,
+    SDL_ASYNCIO_PRIORITY_NORMAL,
+    SDL_ASYNCIO_PRIORITY_HIGH
+} SDL_AsyncIOPriority;
+
+typedef enum
+{
+    SDL_ASYNCIO_COMPLETE,   /**< Read up to \c requested bytes; fewer at end of file */
+    SDL_ASYNCIO_FAILURE,    /**< The file couldn't be opened, sought or allocated for */
+    SDL_ASYNCIO_CANCELLED   /**< Cancelled before it finished */
+} SDL_AsyncIOResult;
+
+/**
+ *  A read request.
+ *
+ *  If \c buffer is NULL, SDL allocates one with room for \c length bytes
+ *  plus a terminating zero, which the app frees with SDL_free(). If
+ *  \c length is 0, the rest of the file from \c offset is read; this needs
+ *  \c buffer to be NULL.
+ */
+typedef struct SDL_AsyncReadRequest
+{
+    const char *file;               /**< As passed to SDL_RWFromFile() */
+    Sint64 offset;                  /**< Where to start reading */
+    size_t length;                  /**< Bytes to read, or 0 for the rest of the file */
+    void *buffer;                   /**< Destination, or NULL to have SDL allocate it */
+    SDL_AsyncIOPriority priority;   /**< Higher priorities are started first */
+    void *userdata;                 /**< Handed back with the result */
+} SDL_AsyncReadRequest;
+
+/**
+ *  The result of a request, from SDL_GetAsyncIOResult().
+ *
+ *  \c buffer is the request's buffer, or the one SDL allocated. SDL frees
+ *  its own buffer when a read fails or is cancelled, so it is NULL then.
+ */
+typedef struct SDL_AsyncIOOutcome
+{
+    SDL_AsyncIOID id;
+    SDL_AsyncIOResult result;
+    void *buffer;
+    Sint64 offset;
+    size_t requested;               /**< Bytes asked for, once known */
+    size_t transferred;             /**< Bytes actually read */
+    void *userdata;
+} SDL_AsyncIOOutcome;
+
+/**
+ *  Create a completion queue for asynchronous reads.
+ *
+ *  The first queue starts the I/O threads (see SDL_HINT_ASYNCIO_THREADS),
+ *  and destroying the last one stops them.
+ *
+ *  If \c event_type is not 0, usually a value from SDL_RegisterEvents(), an
+ *  event of that type is pushed each time a request completes. Its
+ *  \c user.code is the request ID, \c user.data1 the queue and
+ *  \c user.data2 the request's userdata; the result itself is still
+ *  collected with SDL_GetAsyncIOResult(). The event is pushed right after
+ *  the result becomes available, so a thread that is already polling the
+ *  queue may collect the result first.
+ *
+ *  \return the new queue, or NULL on error.
+ */
+extern DECLSPEC SDL_AsyncIOQueue *SDLCALL SDL_CreateAsyncIOQueue(Uint32 event_type);
+
+/**
+ *  Destroy a completion queue.
+ *
+ *  Requests that haven't started are dropped, and this waits for running
+ *  ones to stop. Buffers SDL allocated for results that were never
+ *  collected are freed. Completion events already pushed may still arrive.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue);
+
+/**
+ *  Queue a read.
+ *
+ *  The request's buffer must stay valid until its result has been
+ *  collected.
+ *
+ *  \return the request ID, or 0 on error.
+ */
+extern DECLSPEC SDL_AsyncIOID SDLCALL SDL_AsyncRead(SDL_AsyncIOQueue *queue,
+                                                    const SDL_AsyncReadRequest *request);
+
+/**
+ *  Queue several reads at once.
+ *
+ *  Either all of them are queued or, on error, none are. Pending requests
+ *  for the same file at the same priority are read together through a
+ *  single open of the file, in offset order.
+ *
+ *  If \c ids is not NULL, it is filled with the \c count request IDs.
+ *
+ *  \return 0 on success or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_AsyncReadBatch(SDL_AsyncIOQueue *queue,
+                                               const SDL_AsyncReadRequest *requests,
+                                               int count, SDL_AsyncIOID *ids);
+
+/**
+ *  Cancel a request.
+ *
+ *  A request that hasn't started completes at once; a running one stops
+ *  at its next chunk. Either way its result, SDL_ASYNCIO_CANCELLED unless
+ *  it finished first, is still collected from the queue.
+ *
+ *  \return 0 if the request was pending or running, -1 if it had already
+ *          completed or doesn't exist.
+ */
+extern DECLSPEC int SDLCALL SDL_CancelAsyncIO(SDL_AsyncIOQueue *queue, SDL_AsyncIOID id);
+
+/**
+ *  Collect a completed request, without waiting.
+ *
+ *  \return SDL_TRUE if \c outcome was filled in, SDL_FALSE if nothing has
+ *          completed.
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue,
+                                                      SDL_AsyncIOOutcome *outcome);
+
+/**
+ *  Collect a completed request, waiting up to \c timeout milliseconds for
+ *  one (-1 waits for as long as it takes).
+ *
+ *  This returns at once if there is nothing left that could complete.
+ *
+ *  \return SDL_TRUE if \c outcome was filled in, SDL_FALSE otherwise.
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue,
+                                                       SDL_AsyncIOOutcome *outcome,
+                                                       Sint32 timeout);
+
+/**
+ *  \return the number of requests on the queue that haven't completed yet,
+ *          or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAsyncIOOutstanding(SDL_AsyncIOQueue *queue);
+
+/* @} *//* Asynchronous reads */
+
 /**
  *  \name Read endian functions
  *
@@ -394,6 +394,53 @@ extern DECLSPEC int SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
  */
 extern DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ *  \brief Get a set of memory functions that keep per-thread caches of small blocks
+ *
+ *  Allocations of up to 1024 bytes are served from a cache owned by the
+ *  calling thread, and the caches trade blocks with a shared heap in
+ *  batches, so threads that allocate a lot rarely wait on each other.
+ *  Larger allocations go straight to the heap. A thread's cache goes back
+ *  to the shared heap when the thread exits; on platforms without pthreads
+ *  this only happens for threads created with SDL_CreateThread().
+ *
+ *  Pass these to SDL_SetMemoryFunctions() to use them. They can only free
+ *  memory they allocated, so install them before SDL allocates anything,
+ *  i.e. while SDL_GetNumAllocations() returns 0.
+ */
+extern DECLSPEC void SDLCALL SDL_GetThreadCacheMemoryFunctions(SDL_malloc_func *malloc_func,
+                                                               SDL_calloc_func *calloc_func,
+                                                               SDL_realloc_func *realloc_func,
+                                                               SDL_free_func *free_func);
+
+/**
+ *  \brief Statistics for one size class of the thread caching memory functions
+ *
+ *  The counts of allocations and frees are gathered from each thread when it
+ *  trades blocks with the shared heap, so they can lag behind by a few
+ *  dozen blocks per thread.
+ */
+typedef struct SDL_MemoryCacheStats
+{
+    size_t size;            /**< The largest allocation this class serves */
+    Uint64 allocations;     /**< Blocks handed out */
+    Uint64 frees;           /**< Blocks given back */
+    Uint64 refills;         /**< Batches moved from the shared heap to a thread */
+    Uint64 returns;         /**< Batches moved from a thread to the shared heap */
+    Uint64 system_blocks;   /**< Blocks allocated from the system */
+    int shared_blocks;      /**< Free blocks currently held by the shared heap */
+} SDL_MemoryCacheStats;
+
+/**
+ *  \brief Get per size class statistics for the thread caching memory functions
+ *
+ *  \param stats    An array to fill in, or NULL to only get the number of classes
+ *  \param maxstats The number of elements in \c stats
+ *
+ *  \return The number of size classes.
+ */
+extern DECLSPEC int SDLCALL SDL_GetThreadCacheMemoryStats(SDL_MemoryCacheStats *stats, int maxstats);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
@@ -510,6 +510,18 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             SDL_Surface * dst,
                                             const SDL_Rect * dstrect);
 
+/**
+ *  \brief Perform bilinear scaling between two surfaces of the same 32-bit
+ *         pixel format.
+ *
+ *  The source and destination rectangles work like in SDL_SoftStretch().
+ *  SDL_PIXELFORMAT_ARGB2101010 isn't supported.
+ */
+extern DECLSPEC int SDLCALL SDL_SoftStretchLinear(SDL_Surface * src,
+                                                  const SDL_Rect * srcrect,
+                                                  SDL_Surface * dst,
+                                                  const SDL_Rect * dstrect);
+
 #define SDL_BlitScaled SDL_UpperBlitScaled
 
 /**
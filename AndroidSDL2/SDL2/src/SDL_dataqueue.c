@@ -39,6 +39,14 @@ struct SDL_DataQueue
     SDL_DataQueuePacket *pool; /* these are unused packets. */
     size_t packet_size;   /* size of new packets */
     size_t queued_bytes;  /* number of bytes of data in the queue. */
+
+    /* ring buffer mode, see SDL_NewDataQueueRing(). The read position is
+       only stored by the reader, and the write position only by the writer. */
+    Uint8 *ring;
+    Uint32 ring_mask;
+    SDL_atomic_t ring_read;
+    char pad[SDL_CACHELINE_SIZE];
+    SDL_atomic_t ring_write;
 };
 
 static void
@@ -84,12 +92,45 @@ SDL_NewDataQueue(const size_t _packetlen, const size_t initialslack)
     return queue;
 }
 
+SDL_DataQueue *
+SDL_NewDataQueueRing(const size_t capacity)
+{
+    SDL_DataQueue *queue;
+    Uint32 ringlen = 1024;
+
+    if (capacity > 0x40000000) {
+        SDL_InvalidParamError("capacity");
+        return NULL;
+    }
+    while (ringlen < capacity) {
+        ringlen *= 2;
+    }
+
+    queue = (SDL_DataQueue *) SDL_malloc(sizeof (SDL_DataQueue));
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_zerop(queue);
+    queue->ring = (Uint8 *) SDL_malloc(ringlen);
+    if (!queue->ring) {
+        SDL_free(queue);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_memset(queue->ring, 0, ringlen);  /* fault the pages in now, not while streaming. */
+    queue->ring_mask = ringlen - 1;
+    queue->packet_size = ringlen;
+    return queue;
+}
+
 void
 SDL_FreeDataQueue(SDL_DataQueue *queue)
 {
     if (queue) {
         SDL_FreeDataQueueList(queue->head);
         SDL_FreeDataQueueList(queue->pool);
+        SDL_free(queue->ring);
         SDL_free(queue);
     }
 }
@@ -107,6 +148,11 @@ SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
         return;
     }
 
+    if (queue->ring) {
+        SDL_AtomicSet(&queue->ring_read, SDL_AtomicGet(&queue->ring_write));
+        return;
+    }
+
     packet = queue->head;
 
     /* merge the available pool and the current queue into one list. */
@@ -170,6 +216,54 @@ AllocateDataQueuePacket(SDL_DataQueue *queue)
     return packet;
 }
 
+static int
+SDL_WriteToDataQueueRing(SDL_DataQueue *queue, const Uint8 *data, const size_t len)
+{
+    const Uint32 ringlen = queue->ring_mask + 1;
+    const Uint32 write = (Uint32) queue->ring_write.value;
+    const Uint32 used = write - (Uint32) SDL_AtomicGet(&queue->ring_read);
+    const Uint32 offset = write & queue->ring_mask;
+    Uint32 cpy;
+
+    if (len > (size_t) (ringlen - used)) {
+        return SDL_SetError("Data queue is full");
+    }
+
+    /* the reader is done with this space once it has moved the read position */
+    SDL_MemoryBarrierAcquire();
+    cpy = SDL_min((Uint32) len, ringlen - offset);
+    SDL_memcpy(queue->ring + offset, data, cpy);
+    SDL_memcpy(queue->ring, data + cpy, len - cpy);
+
+    /* Only this thread stores the write position, so a plain store will do */
+    SDL_MemoryBarrierRelease();
+    queue->ring_write.value = (int) (write + (Uint32) len);
+    return 0;
+}
+
+static size_t
+SDL_ReadFromDataQueueRing(SDL_DataQueue *queue, Uint8 *buf, const size_t len, const SDL_bool consume)
+{
+    const Uint32 ringlen = queue->ring_mask + 1;
+    const Uint32 read = (Uint32) queue->ring_read.value;
+    const Uint32 avail = (Uint32) SDL_AtomicGet(&queue->ring_write) - read;
+    const Uint32 offset = read & queue->ring_mask;
+    const Uint32 total = (Uint32) SDL_min(len, (size_t) avail);
+    Uint32 cpy;
+
+    SDL_MemoryBarrierAcquire();
+    cpy = SDL_min(total, ringlen - offset);
+    SDL_memcpy(buf, queue->ring + offset, cpy);
+    SDL_memcpy(buf + cpy, queue->ring, total - cpy);
+
+    if (consume) {
+        /* Only this thread stores the read position, so a plain store will do */
+        SDL_MemoryBarrierRelease();
+        queue->ring_read.value = (int) (read + total);
+    }
+    return total;
+}
+
 
 int
 SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _len)
@@ -186,6 +280,10 @@ SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _len)
         return SDL_InvalidParamError("queue");
     }
 
+    if (queue->ring) {
+        return SDL_WriteToDataQueueRing(queue, data, len);
+    }
+
     orighead = queue->head;
     origtail = queue->tail;
     origlen = origtail ? origtail->datalen : 0;
@@ -237,6 +335,10 @@ SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         return 0;
     }
 
+    if (queue->ring) {
+        return SDL_ReadFromDataQueueRing(queue, buf, len, SDL_FALSE);
+    }
+
     for (packet = queue->head; len && packet; packet = packet->next) {
         const size_t avail = packet->datalen - packet->startpos;
         const size_t cpy = SDL_min(len, avail);
@@ -262,6 +364,10 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         return 0;
     }
 
+    if (queue->ring) {
+        return SDL_ReadFromDataQueueRing(queue, buf, len, SDL_TRUE);
+    }
+
     while ((len > 0) && ((packet = queue->head) != NULL)) {
         const size_t avail = packet->datalen - packet->startpos;
         const size_t cpy = SDL_min(len, avail);
@@ -293,6 +399,9 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
 size_t
 SDL_CountDataQueue(SDL_DataQueue *queue)
 {
+    if (queue && queue->ring) {
+        return (size_t) ((Uint32) SDL_AtomicGet(&queue->ring_write) - (Uint32) SDL_AtomicGet(&queue->ring_read));
+    }
     return queue ? queue->queued_bytes : 0;
 }
 
@@ -307,6 +416,9 @@ SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
     } else if (len == 0) {
         SDL_InvalidParamError("len");
         return NULL;
+    } else if (queue->ring) {
+        SDL_Unsupported();
+        return NULL;
     } else if (len > queue->packet_size) {
         SDL_SetError("len is larger than packet size");
         return NULL;
@@ -27,6 +27,14 @@ struct SDL_DataQueue;
 typedef struct SDL_DataQueue SDL_DataQueue;
 
 SDL_DataQueue *SDL_NewDataQueue(const size_t packetlen, const size_t initialslack);
+
+/* this makes a queue backed by a fixed ring buffer of at least (capacity) bytes,
+   rounded up to a power of two. One thread may write to it while another
+   reads from it without any locking, and it never allocates after creation,
+   but writes that don't fit fail instead of growing the queue.
+   SDL_ClearDataQueue() still needs the reader and writer to be locked out,
+   and SDL_ReserveSpaceInDataQueue() isn't supported. */
+SDL_DataQueue *SDL_NewDataQueueRing(const size_t capacity);
 void SDL_FreeDataQueue(SDL_DataQueue *queue);
 void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack);
 int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *data, const size_t len);
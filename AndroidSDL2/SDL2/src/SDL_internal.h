@@ -51,6 +51,28 @@
 
 #include "SDL_config.h"
 
+/* Lets single functions use instruction sets that the rest of SDL isn't
+   compiled for. They may only be called after checking for the feature at
+   runtime, e.g. with SDL_HasAVX2(). */
+#if defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#define SDL_HAS_TARGET_ATTRIBS 1
+#else
+#define SDL_TARGETING(x)
+#endif
+
+#if (defined(_MSC_VER) && (_MSC_VER >= 1500) && (defined(_M_IX86) || defined(_M_X64)) && !defined(__clang__)) || \
+    (defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && (defined(__i386__) || defined(__x86_64__)) && \
+     (defined(__SSE4_1__) || SDL_HAS_TARGET_ATTRIBS))
+#define SDL_SSE4_1_INTRINSICS 1
+#endif
+
+#if (defined(_MSC_VER) && (_MSC_VER >= 1800) && (defined(_M_IX86) || defined(_M_X64)) && !defined(__clang__)) || \
+    (defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && (defined(__i386__) || defined(__x86_64__)) && \
+     (defined(__AVX2__) || SDL_HAS_TARGET_ATTRIBS))
+#define SDL_AVX2_INTRINSICS 1
+#endif
+
 /* A few #defines to reduce SDL2 footprint.
    Only effective when library is statically linked.
    You have to manually edit this file. */
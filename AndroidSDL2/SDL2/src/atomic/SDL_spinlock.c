@@ -25,6 +25,7 @@
 #endif
 
 #include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_mutex.h"
 #include "SDL_timer.h"
 
@@ -140,6 +141,8 @@ SDL_AtomicTryLock(SDL_SpinLock *lock)
     #define PAUSE_INSTRUCTION() __asm__ __volatile__("pause\n")  /* Some assemblers can't do REP NOP, so go with PAUSE. */
 #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
     #define PAUSE_INSTRUCTION() _mm_pause()  /* this is actually "rep nop" and not a SIMD instruction. No inline asm in MSVC x86-64! */
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+    #define PAUSE_INSTRUCTION() __asm__ __volatile__("yield\n")  /* ARM's spin-wait hint. */
 #elif defined(__WATCOMC__) && defined(__386__)
     /* watcom assembler rejects PAUSE if CPU < i686, and it refuses REP NOP as an invalid combination. Hardcode the bytes.  */
     extern _inline void PAUSE_INSTRUCTION(void);
@@ -148,15 +151,31 @@ SDL_AtomicTryLock(SDL_SpinLock *lock)
     #define PAUSE_INSTRUCTION()
 #endif
 
+/* Pause 1, 2, 4, ... 64 times between attempts before yielding the CPU. */
+#define SPIN_BACKOFF_ROUNDS 7
+
 void
 SDL_AtomicLock(SDL_SpinLock *lock)
 {
-    int iterations = 0;
+    int round = 0;
+    int i;
+
+    /* Spinning is pointless if the holder can't run meanwhile. */
+    if (SDL_GetCPUCount() == 1) {
+        round = SPIN_BACKOFF_ROUNDS;
+    }
+
     /* FIXME: Should we have an eventual timeout? */
     while (!SDL_AtomicTryLock(lock)) {
-        if (iterations < 32) {
-            iterations++;
-            PAUSE_INSTRUCTION();
+        if (round < SPIN_BACKOFF_ROUNDS) {
+            /* Back off exponentially, and wait for the lock to look free
+               with plain reads that don't fight over the cache line. */
+            do {
+                for (i = (1 << round); i > 0; --i) {
+                    PAUSE_INSTRUCTION();
+                }
+                ++round;
+            } while (*(volatile SDL_SpinLock *)lock && round < SPIN_BACKOFF_ROUNDS);
         } else {
             /* !!! FIXME: this doesn't definitely give up the current timeslice, it does different things on various platforms. */
             SDL_Delay(0);
@@ -573,7 +573,8 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     len -= (int) dequeued;
 
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(SDL_CountDataQueue(device->buffer_queue) == 0);
+        /* (with the ring buffer, the app may have queued more in the meantime.) */
+        SDL_assert(device->buffer_queue_ring || SDL_CountDataQueue(device->buffer_queue) == 0);
         SDL_memset(stream, device->spec.silence, len);
     }
 }
@@ -609,9 +610,14 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
-        rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
-        current_audio.impl.UnlockDevice(device);
+        if (device->buffer_queue_ring) {
+            /* the audio thread only reads from the ring, no need to lock. */
+            rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
+        } else {
+            current_audio.impl.LockDevice(device);
+            rc = SDL_WriteToDataQueue(device->buffer_queue, data, len);
+            current_audio.impl.UnlockDevice(device);
+        }
     }
 
     return rc;
@@ -630,6 +636,11 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
         return 0;  /* just report zero bytes dequeued. */
     }
 
+    if (device->buffer_queue_ring) {
+        /* the audio thread only writes to the ring, no need to lock. */
+        return (Uint32) SDL_ReadFromDataQueue(device->buffer_queue, data, len);
+    }
+
     current_audio.impl.LockDevice(device);
     rc = (Uint32) SDL_ReadFromDataQueue(device->buffer_queue, data, len);
     current_audio.impl.UnlockDevice(device);
@@ -650,9 +661,13 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
         device->callbackspec.callback == SDL_BufferQueueFillCallback)
     {
-        current_audio.impl.LockDevice(device);
-        retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
-        current_audio.impl.UnlockDevice(device);
+        if (device->buffer_queue_ring) {
+            retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
+        } else {
+            current_audio.impl.LockDevice(device);
+            retval = (Uint32) SDL_CountDataQueue(device->buffer_queue);
+            current_audio.impl.UnlockDevice(device);
+        }
     }
 
     return retval;
@@ -1408,8 +1423,16 @@ open_audio_device(const char *devname, int iscapture,
     }
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
-        /* pool a few packets to start. Enough for two callbacks. */
-        device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        const char *hint = SDL_GetHint(SDL_HINT_AUDIO_QUEUE_RING_SIZE);
+        const int ringsize = hint ? SDL_atoi(hint) : 0;
+        if (ringsize > 0) {
+            /* a fixed ring buffer, with room for at least two callbacks. */
+            device->buffer_queue = SDL_NewDataQueueRing(SDL_max((size_t) ringsize, obtained->size * 2));
+            device->buffer_queue_ring = SDL_TRUE;
+        } else {
+            /* pool a few packets to start. Enough for two callbacks. */
+            device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
+        }
         if (!device->buffer_queue) {
             close_audio_device(device);
             SDL_SetError("Couldn't create audio buffer queue");
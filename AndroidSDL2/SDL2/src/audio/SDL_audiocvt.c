@@ -28,6 +28,7 @@
 #include "SDL.h"
 #include "SDL_audio.h"
 #include "SDL_audio_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 #include "SDL_loadso.h"
 #include "SDL_assert.h"
@@ -36,46 +37,6 @@
 
 #define DEBUG_AUDIOSTREAM 0
 
-#ifdef __SSE3__
-#define HAVE_SSE3_INTRINSICS 1
-#endif
-
-#if HAVE_SSE3_INTRINSICS
-/* Convert from stereo to mono. Average left and right. */
-static void SDLCALL
-SDL_ConvertStereoToMono_SSE3(SDL_AudioCVT * cvt, SDL_AudioFormat format)
-{
-    float *dst = (float *) cvt->buf;
-    const float *src = dst;
-    int i = cvt->len_cvt / 8;
-
-    LOG_DEBUG_CONVERT("stereo", "mono (using SSE3)");
-    SDL_assert(format == AUDIO_F32SYS);
-
-    /* We can only do this if dst is aligned to 16 bytes; since src is the
-       same pointer and it moves by 2, it can't be forcibly aligned. */
-    if ((((size_t) dst) & 15) == 0) {
-        /* Aligned! Do SSE blocks as long as we have 16 bytes available. */
-        const __m128 divby2 = _mm_set1_ps(0.5f);
-        while (i >= 4) {   /* 4 * float32 */
-            _mm_store_ps(dst, _mm_mul_ps(_mm_hadd_ps(_mm_load_ps(src), _mm_load_ps(src+4)), divby2));
-            i -= 4; src += 8; dst += 4;
-        }
-    }
-
-    /* Finish off any leftovers with scalar operations. */
-    while (i) {
-        *dst = (src[0] + src[1]) * 0.5f;
-        dst++; i--; src += 2;
-    }
-
-    cvt->len_cvt /= 2;
-    if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
-    }
-}
-#endif
-
 /* Convert from stereo to mono. Average left and right. */
 static void SDLCALL
 SDL_ConvertStereoToMono(SDL_AudioCVT * cvt, SDL_AudioFormat format)
@@ -374,6 +335,460 @@ SDL_Convert51To71(SDL_AudioCVT * cvt, SDL_AudioFormat format)
     }
 }
 
+#ifdef __SSE__
+/* SSE versions of the channel converters above. They produce exactly the
+   same output as the scalar code: same operations in the same order, with
+   the divisions kept as divisions. Where a lane must pass through a sum
+   unchanged, it adds -0.0f, which (unlike +0.0f) preserves negative zero.
+   Downmixers walk forward and upmixers walk backward, just like the scalar
+   versions, and every block loads all of its input before storing, so
+   converting in place is safe. Leftover frames use the scalar code. */
+
+static void SDLCALL
+SDL_ConvertStereoToMono_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    int i = cvt->len_cvt / 8;
+
+    LOG_DEBUG_CONVERT("stereo", "mono (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (; i >= 4; i -= 4, src += 8, dst += 4) {
+        const __m128 v0 = _mm_loadu_ps(src);
+        const __m128 v1 = _mm_loadu_ps(src + 4);
+        const __m128 left = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 right = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(dst, _mm_mul_ps(_mm_add_ps(left, right), half));
+    }
+
+    for (; i; --i, src += 2) {
+        *(dst++) = (src[0] + src[1]) * 0.5f;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 twoandahalf = _mm_set1_ps(2.5f);
+    int i = cvt->len_cvt / (sizeof (float) * 6);
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* Two frames at a time: FL FR FC LFE | BL BR FL FR | FC LFE BL BR */
+    for (; i >= 2; i -= 2, src += 12, dst += 4) {
+        const __m128 v0 = _mm_loadu_ps(src);
+        const __m128 v1 = _mm_loadu_ps(src + 4);
+        const __m128 v2 = _mm_loadu_ps(src + 8);
+        const __m128 front = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 2, 1, 0));
+        const __m128 center = _mm_shuffle_ps(v0, v2, _MM_SHUFFLE(0, 0, 2, 2));
+        const __m128 back = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(3, 2, 1, 0));
+        __m128 out = _mm_add_ps(front, _mm_mul_ps(center, half));
+        out = _mm_div_ps(_mm_add_ps(out, back), twoandahalf);
+        _mm_storeu_ps(dst, out);
+    }
+
+    for (; i; --i, src += 6, dst += 2) {
+        const float front_center_distributed = src[2] * 0.5f;
+        dst[0] = (src[0] + front_center_distributed + src[4]) / 2.5f;  /* left */
+        dst[1] = (src[1] + front_center_distributed + src[5]) / 2.5f;  /* right */
+    }
+
+    cvt->len_cvt /= 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    int i = cvt->len_cvt / (sizeof (float) * 4);
+
+    LOG_DEBUG_CONVERT("quad", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (; i >= 2; i -= 2, src += 8, dst += 4) {
+        const __m128 v0 = _mm_loadu_ps(src);
+        const __m128 v1 = _mm_loadu_ps(src + 4);
+        const __m128 front = _mm_movelh_ps(v0, v1);
+        const __m128 back = _mm_movehl_ps(v1, v0);
+        _mm_storeu_ps(dst, _mm_mul_ps(_mm_add_ps(front, back), half));
+    }
+
+    for (; i; --i, src += 4, dst += 2) {
+        dst[0] = (src[0] + src[2]) * 0.5f; /* left */
+        dst[1] = (src[1] + src[3]) * 0.5f; /* right */
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert71To51_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 oneandahalf = _mm_set1_ps(1.5f);
+    const __m128 negzero = _mm_set1_ps(-0.0f);
+    int i = cvt->len_cvt / (sizeof (float) * 8);
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* Two frames in, twelve floats out: each frame is FL FR FC LFE | BL BR SL SR */
+    for (; i >= 2; i -= 2, src += 16, dst += 12) {
+        const __m128 front0 = _mm_loadu_ps(src);
+        const __m128 back0 = _mm_loadu_ps(src + 4);
+        const __m128 front1 = _mm_loadu_ps(src + 8);
+        const __m128 back1 = _mm_loadu_ps(src + 12);
+        /* SL/2 SR/2 -0 -0 */
+        const __m128 sides0 = _mm_movelh_ps(_mm_mul_ps(_mm_movehl_ps(back0, back0), half), negzero);
+        const __m128 sides1 = _mm_movelh_ps(_mm_mul_ps(_mm_movehl_ps(back1, back1), half), negzero);
+        const __m128 outfront0 = _mm_div_ps(_mm_add_ps(front0, sides0), oneandahalf);
+        const __m128 outback0 = _mm_div_ps(_mm_add_ps(back0, sides0), oneandahalf);
+        const __m128 outfront1 = _mm_div_ps(_mm_add_ps(front1, sides1), oneandahalf);
+        const __m128 outback1 = _mm_div_ps(_mm_add_ps(back1, sides1), oneandahalf);
+        _mm_storeu_ps(dst, outfront0);
+        _mm_storeu_ps(dst + 4, _mm_movelh_ps(outback0, outfront1));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(outfront1, outback1, _MM_SHUFFLE(1, 0, 3, 2)));
+    }
+
+    for (; i; --i, src += 8, dst += 6) {
+        const float surround_left_distributed = src[6] * 0.5f;
+        const float surround_right_distributed = src[7] * 0.5f;
+        dst[0] = (src[0] + surround_left_distributed) / 1.5f;  /* FL */
+        dst[1] = (src[1] + surround_right_distributed) / 1.5f;  /* FR */
+        dst[2] = src[2] / 1.5f; /* CC */
+        dst[3] = src[3] / 1.5f; /* LFE */
+        dst[4] = (src[4] + surround_left_distributed) / 1.5f;  /* BL */
+        dst[5] = (src[5] + surround_right_distributed) / 1.5f;  /* BR */
+    }
+
+    cvt->len_cvt /= 8;
+    cvt->len_cvt *= 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51ToQuad_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *) cvt->buf;
+    const float *src = dst;
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 oneandahalf = _mm_set1_ps(1.5f);
+    const __m128 negzero = _mm_set1_ps(-0.0f);
+    int i = cvt->len_cvt / (sizeof (float) * 6);
+
+    LOG_DEBUG_CONVERT("5.1", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* Two frames at a time: FL FR FC LFE | BL BR FL FR | FC LFE BL BR */
+    for (; i >= 2; i -= 2, src += 12, dst += 8) {
+        const __m128 v0 = _mm_loadu_ps(src);
+        const __m128 v1 = _mm_loadu_ps(src + 4);
+        const __m128 v2 = _mm_loadu_ps(src + 8);
+        const __m128 speakers0 = _mm_movelh_ps(v0, v1);
+        const __m128 speakers1 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(3, 2, 3, 2));
+        /* FC/2 FC/2 -0 -0 */
+        const __m128 center0 = _mm_mul_ps(_mm_shuffle_ps(v0, negzero, _MM_SHUFFLE(0, 0, 2, 2)), half);
+        const __m128 center1 = _mm_mul_ps(_mm_shuffle_ps(v2, negzero, _MM_SHUFFLE(0, 0, 0, 0)), half);
+        _mm_storeu_ps(dst, _mm_div_ps(_mm_add_ps(speakers0, center0), oneandahalf));
+        _mm_storeu_ps(dst + 4, _mm_div_ps(_mm_add_ps(speakers1, center1), oneandahalf));
+    }
+
+    for (; i; --i, src += 6, dst += 4) {
+        const float front_center_distributed = src[2] * 0.5f;
+        dst[0] = (src[0] + front_center_distributed) / 1.5f;  /* FL */
+        dst[1] = (src[1] + front_center_distributed) / 1.5f;  /* FR */
+        dst[2] = src[4] / 1.5f;  /* BL */
+        dst[3] = src[5] / 1.5f;  /* BR */
+    }
+
+    cvt->len_cvt /= 6;
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertMonoToStereo_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+    float *dst = (float *) (cvt->buf + cvt->len_cvt * 2);
+    int i = cvt->len_cvt / sizeof (float);
+
+    LOG_DEBUG_CONVERT("mono", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    for (; i & 3; --i) {
+        src--;
+        dst -= 2;
+        dst[0] = dst[1] = *src;
+    }
+
+    for (; i; i -= 4) {
+        __m128 v;
+        src -= 4;
+        dst -= 8;
+        v = _mm_loadu_ps(src);
+        _mm_storeu_ps(dst + 4, _mm_unpackhi_ps(v, v));
+        _mm_storeu_ps(dst, _mm_unpacklo_ps(v, v));
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoTo51_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+    float *dst = (float *) (cvt->buf + cvt->len_cvt * 3);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    int i = cvt->len_cvt / (sizeof (float) * 2);
+    float lf, rf, ce;
+
+    LOG_DEBUG_CONVERT("stereo", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    if (i & 1) {
+        dst -= 6;
+        src -= 2;
+        lf = src[0];
+        rf = src[1];
+        ce = (lf + rf) * 0.5f;
+        dst[0] = lf + (lf - ce);  /* FL */
+        dst[1] = rf + (rf - ce);  /* FR */
+        dst[2] = ce;  /* FC */
+        dst[3] = 0;   /* LFE (only meant for special LFE effects) */
+        dst[4] = lf;  /* BL */
+        dst[5] = rf;  /* BR */
+        i--;
+    }
+
+    /* Two frames at a time: L R L R -> FL FR FC LFE | BL BR FL FR | FC LFE BL BR */
+    for (; i; i -= 2) {
+        __m128 v, centers, center, front, centerlfe;
+        src -= 4;
+        dst -= 12;
+        v = _mm_loadu_ps(src);
+        /* ce0 ce1 ce0 ce1 */
+        centers = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 0, 2, 0)),
+                                        _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        center = _mm_unpacklo_ps(centers, centers);
+        front = _mm_add_ps(v, _mm_sub_ps(v, center));
+        centerlfe = _mm_unpacklo_ps(centers, zero);
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(centerlfe, v, _MM_SHUFFLE(3, 2, 3, 2)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(v, front, _MM_SHUFFLE(3, 2, 1, 0)));
+        _mm_storeu_ps(dst, _mm_movelh_ps(front, centerlfe));
+    }
+
+    cvt->len_cvt *= 3;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertQuadTo51_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+    float *dst = (float *) (cvt->buf + cvt->len_cvt * 3 / 2);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    int i = cvt->len_cvt / (sizeof (float) * 4);
+    float lf, rf, lb, rb, ce;
+
+    LOG_DEBUG_CONVERT("quad", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+    SDL_assert(cvt->len_cvt % (sizeof(float) * 4) == 0);
+
+    if (i & 1) {
+        dst -= 6;
+        src -= 4;
+        lf = src[0];
+        rf = src[1];
+        lb = src[2];
+        rb = src[3];
+        ce = (lf + rf) * 0.5f;
+        dst[0] = lf + (lf - ce);  /* FL */
+        dst[1] = rf + (rf - ce);  /* FR */
+        dst[2] = ce;  /* FC */
+        dst[3] = 0;   /* LFE (only meant for special LFE effects) */
+        dst[4] = lb;  /* BL */
+        dst[5] = rb;  /* BR */
+        i--;
+    }
+
+    /* Two frames at a time: FL FR FC LFE | BL BR FL FR | FC LFE BL BR */
+    for (; i; i -= 2) {
+        __m128 v0, v1, fronts, centers, center, front, centerlfe;
+        src -= 8;
+        dst -= 12;
+        v0 = _mm_loadu_ps(src);
+        v1 = _mm_loadu_ps(src + 4);
+        fronts = _mm_movelh_ps(v0, v1);
+        /* ce0 ce1 ce0 ce1 */
+        centers = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(fronts, fronts, _MM_SHUFFLE(2, 0, 2, 0)),
+                                        _mm_shuffle_ps(fronts, fronts, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        center = _mm_unpacklo_ps(centers, centers);
+        front = _mm_add_ps(fronts, _mm_sub_ps(fronts, center));
+        centerlfe = _mm_unpacklo_ps(centers, zero);
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(centerlfe, v1, _MM_SHUFFLE(3, 2, 3, 2)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(v0, front, _MM_SHUFFLE(3, 2, 3, 2)));
+        _mm_storeu_ps(dst, _mm_movelh_ps(front, centerlfe));
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 3 / 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_ConvertStereoToQuad_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+    float *dst = (float *) (cvt->buf + cvt->len_cvt * 2);
+    int i = cvt->len_cvt / (sizeof(float) * 2);
+    float lf, rf;
+
+    LOG_DEBUG_CONVERT("stereo", "quad (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    if (i & 1) {
+        dst -= 4;
+        src -= 2;
+        lf = src[0];
+        rf = src[1];
+        dst[0] = lf;  /* FL */
+        dst[1] = rf;  /* FR */
+        dst[2] = lf;  /* BL */
+        dst[3] = rf;  /* BR */
+        i--;
+    }
+
+    for (; i; i -= 2) {
+        __m128 v;
+        src -= 4;
+        dst -= 8;
+        v = _mm_loadu_ps(src);
+        _mm_storeu_ps(dst + 4, _mm_movehl_ps(v, v));
+        _mm_storeu_ps(dst, _mm_movelh_ps(v, v));
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+static void SDLCALL
+SDL_Convert51To71_SSE(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) (cvt->buf + cvt->len_cvt);
+    float *dst = (float *) (cvt->buf + cvt->len_cvt * 4 / 3);
+    const __m128 half = _mm_set1_ps(0.5f);
+    int i = cvt->len_cvt / (sizeof(float) * 6);
+    float lf, rf, lb, rb, ls, rs;
+
+    LOG_DEBUG_CONVERT("5.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+    SDL_assert(cvt->len_cvt % (sizeof(float) * 6) == 0);
+
+    if (i & 1) {
+        dst -= 8;
+        src -= 6;
+        lf = src[0];
+        rf = src[1];
+        lb = src[4];
+        rb = src[5];
+        ls = (lf + lb) * 0.5f;
+        rs = (rf + rb) * 0.5f;
+        /* matches the scalar version, which offsets all four by ls */
+        lf += lf - ls;
+        rf += rf - ls;
+        lb += lb - ls;
+        rb += rb - ls;
+        dst[3] = src[3];  /* LFE */
+        dst[2] = src[2];  /* FC */
+        dst[7] = rs; /* SR */
+        dst[6] = ls; /* SL */
+        dst[5] = rb;  /* BR */
+        dst[4] = lb;  /* BL */
+        dst[1] = rf;  /* FR */
+        dst[0] = lf;  /* FL */
+        i--;
+    }
+
+    /* Two frames at a time: FL FR FC LFE | BL BR FL FR | FC LFE BL BR */
+    for (; i; i -= 2) {
+        __m128 v0, v1, v2, fronts, backs, sides, left, outfronts, outbacks;
+        src -= 12;
+        dst -= 16;
+        v0 = _mm_loadu_ps(src);
+        v1 = _mm_loadu_ps(src + 4);
+        v2 = _mm_loadu_ps(src + 8);
+        fronts = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 2, 1, 0));
+        backs = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(3, 2, 1, 0));
+        sides = _mm_mul_ps(_mm_add_ps(fronts, backs), half);  /* ls0 rs0 ls1 rs1 */
+        left = _mm_shuffle_ps(sides, sides, _MM_SHUFFLE(2, 2, 0, 0));
+        outfronts = _mm_add_ps(fronts, _mm_sub_ps(fronts, left));
+        outbacks = _mm_add_ps(backs, _mm_sub_ps(backs, left));
+        _mm_storeu_ps(dst + 12, _mm_movehl_ps(sides, outbacks));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(outfronts, v2, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(dst + 4, _mm_movelh_ps(outbacks, sides));
+        _mm_storeu_ps(dst, _mm_shuffle_ps(outfronts, v0, _MM_SHUFFLE(3, 2, 1, 0)));
+    }
+
+    cvt->len_cvt = cvt->len_cvt * 4 / 3;
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+#endif /* __SSE__ */
+
+/* Picks the SSE version of a channel converter when the CPU allows it. */
+static SDL_AudioFilter
+SDL_ChooseChannelConverter(SDL_AudioFilter filter, SDL_AudioFilter filter_sse)
+{
+    if (filter_sse && (SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_CHANNELS) & CPU_HAS_SSE)) {
+        return filter_sse;
+    }
+    return filter;
+}
+
+#ifdef __SSE__
+#define CHANNEL_CONVERTER(name) SDL_ChooseChannelConverter(name, name##_SSE)
+#else
+#define CHANNEL_CONVERTER(name) SDL_ChooseChannelConverter(name, NULL)
+#endif
+
 /* SDL's resampler uses a "bandlimited interpolation" algorithm:
      https://ccrma.stanford.edu/~jos/resample/ */
 
@@ -431,6 +846,27 @@ static SDL_SpinLock ResampleFilterSpinlock = 0;
 static float *ResamplerFilter = NULL;
 static float *ResamplerFilterDifference = NULL;
 
+/* For rate pairs whose pattern of filter positions repeats often enough, the
+   filter taps for every position are worked out once and kept in a bank. */
+#define RESAMPLER_BANK_TAPS (2 * (RESAMPLER_ZERO_CROSSINGS + 1))
+#define RESAMPLER_MAX_BANK_PHASES 1024
+#define RESAMPLER_MAX_BANKS 32
+
+typedef struct SDL_ResampleBank
+{
+    int inrate;
+    int outrate;
+    int chans;
+    int phases;         /* output frames before the pattern repeats */
+    int instep;         /* input frames the pattern covers */
+    int *srcindex;      /* first input frame for each phase, relative to the pattern */
+    float *coeffs;      /* RESAMPLER_BANK_TAPS * chans per phase, repeated for each channel */
+    struct SDL_ResampleBank *next;
+} SDL_ResampleBank;
+
+static SDL_ResampleBank *ResamplerBanks = NULL;
+static int ResamplerNumBanks = 0;
+
 int
 SDL_PrepareResampleFilter(void)
 {
@@ -463,6 +899,15 @@ SDL_PrepareResampleFilter(void)
 void
 SDL_FreeResampleFilter(void)
 {
+    while (ResamplerBanks) {
+        SDL_ResampleBank *bank = ResamplerBanks;
+        ResamplerBanks = bank->next;
+        SDL_free(bank->srcindex);
+        SDL_SIMDFree(bank->coeffs);
+        SDL_free(bank);
+    }
+    ResamplerNumBanks = 0;
+
     SDL_free(ResamplerFilter);
     SDL_free(ResamplerFilterDifference);
     ResamplerFilter = NULL;
@@ -480,9 +925,288 @@ ResamplerPadding(const int inrate, const int outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+static SDL_ResampleBank *
+SDL_CreateResampleBank(const int chans, const int inrate, const int outrate)
+{
+    SDL_ResampleBank *bank;
+    int a = inrate, b = outrate;
+    int phase, i, j;
+
+    while (b) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    if ((outrate / a) > RESAMPLER_MAX_BANK_PHASES) {
+        return NULL;  /* use the scalar path for this ratio */
+    }
+
+    bank = (SDL_ResampleBank *) SDL_calloc(1, sizeof (*bank));
+    if (!bank) {
+        return NULL;
+    }
+    bank->inrate = inrate;
+    bank->outrate = outrate;
+    bank->chans = chans;
+    bank->phases = outrate / a;
+    bank->instep = inrate / a;
+    bank->srcindex = (int *) SDL_malloc(bank->phases * sizeof (int));
+    bank->coeffs = (float *) SDL_SIMDAlloc(bank->phases * RESAMPLER_BANK_TAPS * chans * sizeof (float));
+    if (!bank->srcindex || !bank->coeffs) {
+        SDL_free(bank->srcindex);
+        SDL_SIMDFree(bank->coeffs);
+        SDL_free(bank);
+        return NULL;
+    }
+
+    /* These are the taps SDL_ResampleAudio_Scalar() walks for each frame, except that
+       the filter table is interpolated by the position between its entries. */
+    for (phase = 0; phase < bank->phases; phase++) {
+        const Sint64 pos = (Sint64) phase * bank->instep;
+        const double interpolation1 = ((double) (pos % bank->phases)) / ((double) bank->phases);
+        const double filterpos1 = interpolation1 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+        const int filterindex1 = (int) filterpos1;
+        const double interpolation2 = 1.0 - interpolation1;
+        const double filterpos2 = interpolation2 * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+        const int filterindex2 = (int) filterpos2;
+        float taps[RESAMPLER_BANK_TAPS];
+        float *coeffs = bank->coeffs + (phase * RESAMPLER_BANK_TAPS * chans);
+
+        SDL_zero(taps);
+        for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int k = filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            taps[RESAMPLER_ZERO_CROSSINGS - j] = (float) (ResamplerFilter[k] + ((filterpos1 - filterindex1) * ResamplerFilterDifference[k]));
+        }
+        for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int k = filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING);
+            taps[RESAMPLER_ZERO_CROSSINGS + 1 + j] = (float) (ResamplerFilter[k] + ((filterpos2 - filterindex2) * ResamplerFilterDifference[k]));
+        }
+
+        bank->srcindex[phase] = (int) (pos / bank->phases) - RESAMPLER_ZERO_CROSSINGS;
+        for (i = 0; i < RESAMPLER_BANK_TAPS; i++) {
+            for (j = 0; j < chans; j++) {
+                *(coeffs++) = taps[i];
+            }
+        }
+    }
+    return bank;
+}
+
+/* Find or build the filter bank for a rate pair, or NULL to use the scalar path */
+static const SDL_ResampleBank *
+SDL_GetResampleBank(const int chans, const int inrate, const int outrate)
+{
+    SDL_ResampleBank *bank;
+
+    SDL_AtomicLock(&ResampleFilterSpinlock);
+    for (bank = ResamplerBanks; bank; bank = bank->next) {
+        if (bank->inrate == inrate && bank->outrate == outrate && bank->chans == chans) {
+            break;
+        }
+    }
+    if (!bank && ResamplerNumBanks < RESAMPLER_MAX_BANKS && ResamplerFilter) {
+        bank = SDL_CreateResampleBank(chans, inrate, outrate);
+        if (bank) {
+            bank->next = ResamplerBanks;
+            ResamplerBanks = bank;
+            ResamplerNumBanks++;
+        }
+    }
+    SDL_AtomicUnlock(&ResampleFilterSpinlock);
+    return bank;
+}
+
+/* Each of these computes one output frame from the RESAMPLER_BANK_TAPS input
+   frames starting at src. */
+typedef void (*SDL_ResampleFrameFunc)(const float *src, const float *coeffs, float *dst, const int chans);
+
+static void
+SDL_ResampleFrame_Scalar(const float *src, const float *coeffs, float *dst, const int chans)
+{
+    int i, chan;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = chan; i < (RESAMPLER_BANK_TAPS * chans); i += chans) {
+            outsample += src[i] * coeffs[i];
+        }
+        dst[chan] = outsample;
+    }
+}
+
+#ifdef __SSE__
+static void
+SDL_ResampleFrame_SSE(const float *src, const float *coeffs, float *dst, const int chans)
+{
+    __m128 acc, acc2;
+    int i;
+
+    switch (chans) {
+    case 1:
+        acc = _mm_mul_ps(_mm_loadu_ps(src), _mm_loadu_ps(coeffs));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_loadu_ps(coeffs + 4)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 8), _mm_loadu_ps(coeffs + 8)));
+        acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, acc);
+        break;
+    case 2:
+    case 4:
+        acc = _mm_setzero_ps();
+        for (i = 0; i < (RESAMPLER_BANK_TAPS * chans); i += 4) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(coeffs + i)));
+        }
+        if (chans == 2) {
+            acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+            _mm_storel_pi((__m64 *) dst, acc);
+        } else {
+            _mm_storeu_ps(dst, acc);
+        }
+        break;
+    case 8:
+        acc = acc2 = _mm_setzero_ps();
+        for (i = 0; i < (RESAMPLER_BANK_TAPS * 8); i += 8) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(coeffs + i)));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(src + i + 4), _mm_loadu_ps(coeffs + i + 4)));
+        }
+        _mm_storeu_ps(dst, acc);
+        _mm_storeu_ps(dst + 4, acc2);
+        break;
+    case 6:
+        acc = acc2 = _mm_setzero_ps();
+        for (i = 0; i < (RESAMPLER_BANK_TAPS * 6); i += 6) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(coeffs + i)));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadl_pi(acc2, (const __m64 *) (src + i + 4)),
+                                               _mm_loadl_pi(acc2, (const __m64 *) (coeffs + i + 4))));
+        }
+        _mm_storeu_ps(dst, acc);
+        _mm_storel_pi((__m64 *) (dst + 4), acc2);
+        break;
+    default:
+        SDL_ResampleFrame_Scalar(src, coeffs, dst, chans);
+        break;
+    }
+}
+#endif /* __SSE__ */
+
+#if SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+SDL_ResampleFrame_AVX2(const float *src, const float *coeffs, float *dst, const int chans)
+{
+    __m256 acc;
+    __m128 acc4;
+    int i;
+
+    switch (chans) {
+    case 1:
+        acc = _mm256_mul_ps(_mm256_loadu_ps(src), _mm256_loadu_ps(coeffs));
+        acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        acc4 = _mm_add_ps(acc4, _mm_mul_ps(_mm_loadu_ps(src + 8), _mm_loadu_ps(coeffs + 8)));
+        acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+        acc4 = _mm_add_ss(acc4, _mm_shuffle_ps(acc4, acc4, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, acc4);
+        break;
+    case 2:
+    case 4:
+    case 8:
+        acc = _mm256_setzero_ps();
+        for (i = 0; i < (RESAMPLER_BANK_TAPS * chans); i += 8) {
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(src + i), _mm256_loadu_ps(coeffs + i)));
+        }
+        if (chans == 8) {
+            _mm256_storeu_ps(dst, acc);
+            break;
+        }
+        acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        if (chans == 2) {
+            acc4 = _mm_add_ps(acc4, _mm_movehl_ps(acc4, acc4));
+            _mm_storel_pi((__m64 *) dst, acc4);
+        } else {
+            _mm_storeu_ps(dst, acc4);
+        }
+        break;
+    default:
+#ifdef __SSE__
+        SDL_ResampleFrame_SSE(src, coeffs, dst, chans);
+#else
+        SDL_ResampleFrame_Scalar(src, coeffs, dst, chans);
+#endif
+        break;
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+static SDL_ResampleFrameFunc
+SDL_ChooseResampleFrame(void)
+{
+    const Uint32 isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_RESAMPLE);
+
+    (void) isas;
+#if SDL_AVX2_INTRINSICS
+    if (isas & CPU_HAS_AVX2) {
+        return SDL_ResampleFrame_AVX2;
+    }
+#endif
+#ifdef __SSE__
+    if (isas & CPU_HAS_SSE) {
+        return SDL_ResampleFrame_SSE;
+    }
+#endif
+    return SDL_ResampleFrame_Scalar;
+}
+
+static int
+SDL_ResampleAudio_Bank(const SDL_ResampleBank *bank, const int paddinglen,
+                       const float *lpadding, const float *rpadding,
+                       const float *inbuf, const int inframes,
+                       float *dst, const int outframes)
+{
+    const int chans = bank->chans;
+    const int framelen = RESAMPLER_BANK_TAPS * chans;
+    const SDL_ResampleFrameFunc resample_frame = SDL_ChooseResampleFrame();
+    float edge[RESAMPLER_BANK_TAPS * 8];
+    int patternstart = 0;
+    int phase = 0;
+    int i, j;
+
+    SDL_assert(chans <= 8);
+
+    for (i = 0; i < outframes; i++) {
+        const int first = patternstart + bank->srcindex[phase];
+        const float *src = inbuf + (first * chans);
+
+        if (first < 0 || (first + RESAMPLER_BANK_TAPS) > inframes) {
+            /* Near the ends of the buffer, gather the taps from the padding */
+            for (j = 0; j < RESAMPLER_BANK_TAPS; j++) {
+                const int srcframe = first + j;
+                const float *sample;
+                if (srcframe < 0) {
+                    sample = lpadding + ((paddinglen + srcframe) * chans);
+                } else if (srcframe >= inframes) {
+                    sample = rpadding + ((srcframe - inframes) * chans);
+                } else {
+                    sample = inbuf + (srcframe * chans);
+                }
+                SDL_memcpy(edge + (j * chans), sample, chans * sizeof (float));
+            }
+            src = edge;
+        }
+
+        resample_frame(src, bank->coeffs + (phase * framelen), dst, chans);
+        dst += chans;
+
+        if (++phase == bank->phases) {
+            phase = 0;
+            patternstart += bank->instep;
+        }
+    }
+
+    return outframes * chans * sizeof (float);
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof (float)) bytes. */
 static int
-SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+SDL_ResampleAudio_Scalar(const int chans, const int inrate, const int outrate,
                         const float *lpadding, const float *rpadding,
                         const float *inbuf, const int inbuflen,
                         float *outbuf, const int outbuflen)
@@ -536,6 +1260,32 @@ SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
     return outframes * chans * sizeof (float);
 }
 
+static int
+SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+                        const float *lpadding, const float *rpadding,
+                        const float *inbuf, const int inbuflen,
+                        float *outbuf, const int outbuflen)
+{
+    const SDL_ResampleBank *bank = NULL;
+
+    if (chans <= 8) {
+        bank = SDL_GetResampleBank(chans, inrate, outrate);
+    }
+    if (bank) {
+        const double ratio = ((float) outrate) / ((float) inrate);
+        const int framelen = chans * (int)sizeof (float);
+        const int inframes = inbuflen / framelen;
+        const int wantedoutframes = (int) ((inbuflen / framelen) * ratio);  /* outbuflen isn't total to write, it's total available. */
+        const int maxoutframes = outbuflen / framelen;
+        const int outframes = SDL_min(wantedoutframes, maxoutframes);
+        return SDL_ResampleAudio_Bank(bank, ResamplerPadding(inrate, outrate), lpadding, rpadding,
+                                      inbuf, inframes, outbuf, outframes);
+    }
+
+    return SDL_ResampleAudio_Scalar(chans, inrate, outrate, lpadding, rpadding,
+                                    inbuf, inbuflen, outbuf, outbuflen);
+}
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -827,6 +1577,245 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, const int dst_channels,
     return 1;               /* added a converter. */
 }
 
+/* Rate conversions go through the filter chain in one pass when the resampler
+   has a filter bank for the rate pair: a block of input frames goes through
+   the filters before the resampler, gets resampled, and the output goes
+   through the filters after it while all of it is still in the cache. The
+   fused filter sits in front of the regular chain and falls back to running
+   it when it can't do the job. */
+#define RESAMPLER_FUSED_BLOCK_FRAMES 512
+
+/* Largest sample frame any filter before the resampler produces: 7.1 float32. */
+#define RESAMPLER_FUSED_MAX_FRAMESIZE (8 * sizeof (float))
+
+static int
+CVTResamplerChannels(const SDL_AudioFilter filter)
+{
+    if (filter == SDL_ResampleCVT_c1) {
+        return 1;
+    } else if (filter == SDL_ResampleCVT_c2) {
+        return 2;
+    } else if (filter == SDL_ResampleCVT_c4) {
+        return 4;
+    } else if (filter == SDL_ResampleCVT_c6) {
+        return 6;
+    } else if (filter == SDL_ResampleCVT_c8) {
+        return 8;
+    }
+    return 0;
+}
+
+/* Runs a filter chain copied out of a cvt over one block, returns the new length. */
+static int
+SDL_RunCVTFilterBlock(SDL_AudioCVT *block, Uint8 *buf, const int len, const SDL_AudioFormat format)
+{
+    if (block->filters[0] == NULL) {
+        return len;
+    }
+    block->buf = buf;
+    block->len = len;
+    block->len_cvt = len;
+    block->filter_index = 0;
+    block->filters[0](block, format);
+    return block->len_cvt;
+}
+
+static void
+SDL_ResampleFusedCVT(SDL_AudioCVT *cvt, const int src_chans, const SDL_AudioFormat format)
+{
+    const int inrate = (int) (size_t) cvt->filters[SDL_AUDIOCVT_MAX_FILTERS-1];
+    const int outrate = (int) (size_t) cvt->filters[SDL_AUDIOCVT_MAX_FILTERS];
+    const int srcframesize = (SDL_AUDIO_BITSIZE(format) / 8) * src_chans;
+    const SDL_ResampleBank *bank = NULL;
+    SDL_ResampleFrameFunc resample_frame;
+    SDL_AudioCVT pre, post;
+    const Uint8 *src;
+    Uint8 *scratch = NULL;
+    float *window, *outblock;
+    Uint8 *convblock;
+    int chans = 0, framelen, inframes, outframes, written = 0;
+    int winstart, winend, patternstart = 0, phase = 0;
+    int resampler, i, j;
+
+    for (resampler = cvt->filter_index + 1; cvt->filters[resampler]; resampler++) {
+        chans = CVTResamplerChannels(cvt->filters[resampler]);
+        if (chans) {
+            break;
+        }
+    }
+
+    if (chans && (cvt->len_cvt % srcframesize) == 0) {
+        bank = SDL_GetResampleBank(chans, inrate, outrate);
+    }
+    if (bank) {
+        const size_t windowlen = (RESAMPLER_BANK_TAPS + RESAMPLER_FUSED_BLOCK_FRAMES) * chans * sizeof (float);
+        const size_t convlen = RESAMPLER_FUSED_BLOCK_FRAMES * RESAMPLER_FUSED_MAX_FRAMESIZE;
+        const size_t outlen = RESAMPLER_FUSED_BLOCK_FRAMES * chans * sizeof (float);
+        scratch = (Uint8 *) SDL_SIMDAlloc(windowlen + convlen + outlen);
+    }
+    if (!scratch) {
+        /* No filter bank for this rate pair (or no memory); run the separate passes. */
+        if (cvt->filters[++cvt->filter_index]) {
+            cvt->filters[cvt->filter_index](cvt, format);
+        }
+        return;
+    }
+
+    /* Split the chain into the filters before and after the resampler. */
+    SDL_zero(pre);
+    SDL_zero(post);
+    for (i = cvt->filter_index + 1, j = 0; i < resampler; i++, j++) {
+        pre.filters[j] = cvt->filters[i];
+    }
+    for (i = resampler + 1, j = 0; cvt->filters[i]; i++, j++) {
+        post.filters[j] = cvt->filters[i];
+    }
+
+    convblock = scratch;
+    outblock = (float *) (convblock + (RESAMPLER_FUSED_BLOCK_FRAMES * RESAMPLER_FUSED_MAX_FRAMESIZE));
+    window = outblock + (RESAMPLER_FUSED_BLOCK_FRAMES * chans);
+
+    /* Same output length as SDL_ResampleCVT() works out. */
+    framelen = chans * (int) sizeof (float);
+    inframes = cvt->len_cvt / srcframesize;
+    {
+        const double ratio = ((float) outrate) / ((float) inrate);
+        const int wantedoutframes = (int) (inframes * ratio);
+        const int maxoutframes = ((cvt->len * cvt->len_mult) - (inframes * framelen)) / framelen;
+        outframes = SDL_min(wantedoutframes, maxoutframes);
+    }
+
+    /* The output is written from the start of the buffer. If it grows faster
+       than the input is consumed, move the input out of the way first. */
+    src = cvt->buf;
+    if (cvt->len_ratio > 1.0) {
+        const int srcoffset = (cvt->len * cvt->len_mult) - cvt->len_cvt;
+        SDL_memmove(cvt->buf + srcoffset, cvt->buf, cvt->len_cvt);
+        src = cvt->buf + srcoffset;
+    }
+
+    resample_frame = SDL_ChooseResampleFrame();
+
+    /* The window holds converted input frames winstart..winend-1, with silence
+       for the frames before and after the buffer. */
+    winstart = winend = bank->srcindex[0];
+
+    for (i = 0; i < outframes; i += RESAMPLER_FUSED_BLOCK_FRAMES) {
+        const int blockframes = SDL_min(RESAMPLER_FUSED_BLOCK_FRAMES, outframes - i);
+        float *dst = outblock;
+        int len;
+
+        for (j = 0; j < blockframes; j++) {
+            const int first = patternstart + bank->srcindex[phase];
+
+            if ((first + RESAMPLER_BANK_TAPS) > winend) {
+                /* Keep the frames still needed and convert the next input block behind them. */
+                if (first < winend) {
+                    SDL_memmove(window, window + ((first - winstart) * chans), (winend - first) * framelen);
+                } else {
+                    winend = first;
+                }
+                winstart = first;
+
+                while (winend < (first + RESAMPLER_BANK_TAPS)) {
+                    Uint8 *tail = (Uint8 *) (window + ((winend - winstart) * chans));
+                    const int room = (RESAMPLER_BANK_TAPS + RESAMPLER_FUSED_BLOCK_FRAMES) - (winend - winstart);
+                    int frames;
+
+                    if (winend < 0) {
+                        frames = SDL_min(-winend, room);
+                        SDL_memset(tail, '\0', frames * framelen);
+                    } else if (winend < inframes) {
+                        frames = SDL_min(SDL_min(RESAMPLER_FUSED_BLOCK_FRAMES, inframes - winend), room);
+                        SDL_memcpy(convblock, src + (winend * srcframesize), frames * srcframesize);
+                        SDL_RunCVTFilterBlock(&pre, convblock, frames * srcframesize, format);
+                        SDL_memcpy(tail, convblock, frames * framelen);
+                    } else {
+                        frames = (first + RESAMPLER_BANK_TAPS) - winend;
+                        SDL_memset(tail, '\0', frames * framelen);
+                    }
+                    winend += frames;
+                }
+            }
+
+            resample_frame(window + ((first - winstart) * chans), bank->coeffs + (phase * RESAMPLER_BANK_TAPS * chans), dst, chans);
+            dst += chans;
+
+            if (++phase == bank->phases) {
+                phase = 0;
+                patternstart += bank->instep;
+            }
+        }
+
+        len = SDL_RunCVTFilterBlock(&post, (Uint8 *) outblock, blockframes * framelen, AUDIO_F32SYS);
+        SDL_memcpy(cvt->buf + written, outblock, len);
+        written += len;
+    }
+
+    SDL_SIMDFree(scratch);
+
+    /* Everything behind us in the chain has been run. */
+    cvt->len_cvt = written;
+    while (cvt->filters[cvt->filter_index]) {
+        cvt->filter_index++;
+    }
+}
+
+#define RESAMPLER_FUSED_FUNCS(chans) \
+    static void SDLCALL \
+    SDL_ResampleFusedCVT_c##chans(SDL_AudioCVT *cvt, SDL_AudioFormat format) { \
+        SDL_ResampleFusedCVT(cvt, chans, format); \
+    }
+RESAMPLER_FUSED_FUNCS(1)
+RESAMPLER_FUSED_FUNCS(2)
+RESAMPLER_FUSED_FUNCS(4)
+RESAMPLER_FUSED_FUNCS(6)
+RESAMPLER_FUSED_FUNCS(8)
+#undef RESAMPLER_FUSED_FUNCS
+
+static SDL_AudioFilter
+ChooseCVTFusedResampler(const int src_channels)
+{
+    switch (src_channels) {
+        case 1: return SDL_ResampleFusedCVT_c1;
+        case 2: return SDL_ResampleFusedCVT_c2;
+        case 4: return SDL_ResampleFusedCVT_c4;
+        case 6: return SDL_ResampleFusedCVT_c6;
+        case 8: return SDL_ResampleFusedCVT_c8;
+        default: break;
+    }
+
+    return NULL;
+}
+
+/* Puts the fused filter in front of a chain that resamples, if there's room for it. */
+static int
+SDL_BuildAudioFusedCVT(SDL_AudioCVT * cvt, const int src_channels, const int dst_channels,
+                       const int src_rate, const int dst_rate)
+{
+    const SDL_AudioFilter filter = ChooseCVTFusedResampler(src_channels);
+
+    if ((src_rate == dst_rate) || (filter == NULL)) {
+        return 0;
+    }
+
+    /* The last two slots hold the rates, see SDL_BuildAudioResampleCVT(). */
+    if (cvt->filter_index >= (SDL_AUDIOCVT_MAX_FILTERS-2)) {
+        return 0;
+    }
+
+    /* Only worth it if the resampler will use a filter bank for these rates. */
+    if (!SDL_GetResampleBank(dst_channels, src_rate, dst_rate)) {
+        return 0;
+    }
+
+    SDL_memmove(&cvt->filters[1], &cvt->filters[0], (cvt->filter_index + 1) * sizeof (cvt->filters[0]));
+    cvt->filters[0] = filter;
+    cvt->filter_index++;
+
+    return 1;
+}
+
 static SDL_bool
 SDL_SupportedAudioFormat(const SDL_AudioFormat fmt)
 {
@@ -879,6 +1868,8 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
                   SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
                   SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
 {
+    const Uint8 orig_src_channels = src_channels;
+
     /* Sanity check target pointer */
     if (cvt == NULL) {
         return SDL_InvalidParamError("cvt");
@@ -963,7 +1954,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         /* Upmixing */
         /* Mono -> Stereo [-> ...] */
         if ((src_channels == 1) && (dst_channels > 1)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_ConvertMonoToStereo) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertMonoToStereo)) < 0) {
                 return -1;
             }
             cvt->len_mult *= 2;
@@ -972,7 +1963,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [Mono ->] Stereo -> 5.1 [-> 7.1] */
         if ((src_channels == 2) && (dst_channels >= 6)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_ConvertStereoTo51) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertStereoTo51)) < 0) {
                 return -1;
             }
             src_channels = 6;
@@ -981,7 +1972,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* Quad -> 5.1 [-> 7.1] */
         if ((src_channels == 4) && (dst_channels >= 6)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_ConvertQuadTo51) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertQuadTo51)) < 0) {
                 return -1;
             }
             src_channels = 6;
@@ -990,7 +1981,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [[Mono ->] Stereo ->] 5.1 -> 7.1 */
         if ((src_channels == 6) && (dst_channels == 8)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert51To71) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_Convert51To71)) < 0) {
                 return -1;
             }
             src_channels = 8;
@@ -1001,7 +1992,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [Mono ->] Stereo -> Quad */
         if ((src_channels == 2) && (dst_channels == 4)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_ConvertStereoToQuad) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertStereoToQuad)) < 0) {
                 return -1;
             }
             src_channels = 4;
@@ -1013,7 +2004,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         /* 7.1 -> 5.1 [-> Stereo [-> Mono]] */
         /* 7.1 -> 5.1 [-> Quad] */
         if ((src_channels == 8) && (dst_channels <= 6)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert71To51) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_Convert71To51)) < 0) {
                 return -1;
             }
             src_channels = 6;
@@ -1021,7 +2012,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [7.1 ->] 5.1 -> Stereo [-> Mono] */
         if ((src_channels == 6) && (dst_channels <= 2)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert51ToStereo) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_Convert51ToStereo)) < 0) {
                 return -1;
             }
             src_channels = 2;
@@ -1029,7 +2020,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* 5.1 -> Quad */
         if ((src_channels == 6) && (dst_channels == 4)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert51ToQuad) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_Convert51ToQuad)) < 0) {
                 return -1;
             }
             src_channels = 4;
@@ -1037,7 +2028,7 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* Quad -> Stereo [-> Mono] */
         if ((src_channels == 4) && (dst_channels <= 2)) {
-            if (SDL_AddAudioCVTFilter(cvt, SDL_ConvertQuadToStereo) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertQuadToStereo)) < 0) {
                 return -1;
             }
             src_channels = 2;
@@ -1045,22 +2036,9 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         }
         /* [... ->] Stereo -> Mono */
         if ((src_channels == 2) && (dst_channels == 1)) {
-            SDL_AudioFilter filter = NULL;
-
-            #if HAVE_SSE3_INTRINSICS
-            if (SDL_HasSSE3()) {
-                filter = SDL_ConvertStereoToMono_SSE3;
-            }
-            #endif
-
-            if (!filter) {
-                filter = SDL_ConvertStereoToMono;
-            }
-
-            if (SDL_AddAudioCVTFilter(cvt, filter) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, CHANNEL_CONVERTER(SDL_ConvertStereoToMono)) < 0) {
                 return -1;
             }
-
             src_channels = 1;
             cvt->len_ratio /= 2;
         }
@@ -1082,6 +2060,11 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         return -1;              /* shouldn't happen, but just in case... */
     }
 
+    /* Do the whole chain in one pass over the buffer, if possible. */
+    if (SDL_BuildAudioFusedCVT(cvt, orig_src_channels, dst_channels, src_rate, dst_rate) < 0) {
+        return -1;
+    }
+
     cvt->needed = (cvt->filter_index != 0);
     return (cvt->needed);
 }
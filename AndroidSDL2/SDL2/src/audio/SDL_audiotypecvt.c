@@ -24,6 +24,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_assert.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 #ifdef __ARM_NEON
 #define HAVE_NEON_INTRINSICS 1
@@ -33,20 +34,6 @@
 #define HAVE_SSE2_INTRINSICS 1
 #endif
 
-#if defined(__x86_64__) && HAVE_SSE2_INTRINSICS
-#define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* x86_64 guarantees SSE2. */
-#elif __MACOSX__ && HAVE_SSE2_INTRINSICS
-#define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* Mac OS X/Intel guarantees SSE2. */
-#elif defined(__ARM_ARCH) && (__ARM_ARCH >= 8) && HAVE_NEON_INTRINSICS
-#define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* ARMv8+ promise NEON. */
-#elif defined(__APPLE__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && HAVE_NEON_INTRINSICS
-#define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* All Apple ARMv7 chips promise NEON support. */
-#endif
-
-/* Set to zero if platform is guaranteed to use a SIMD codepath here. */
-#ifndef NEED_SCALAR_CONVERTER_FALLBACKS
-#define NEED_SCALAR_CONVERTER_FALLBACKS 1
-#endif
 
 /* Function pointers set to a CPU-specific implementation. */
 SDL_AudioFilter SDL_Convert_S8_to_F32 = NULL;
@@ -66,7 +53,7 @@ SDL_AudioFilter SDL_Convert_F32_to_S32 = NULL;
 #define DIVBY8388607 0.00000011920930376163766f
 
 
-#if NEED_SCALAR_CONVERTER_FALLBACKS
+/* The scalar converters are always built: SDL_HINT_CPU_FEATURE_MASK can rule out the SIMD ones. */
 static void SDLCALL
 SDL_Convert_S8_to_F32_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
@@ -289,7 +276,6 @@ SDL_Convert_F32_to_S32_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
         cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
     }
 }
-#endif
 
 
 #if HAVE_SSE2_INTRINSICS
@@ -851,6 +837,369 @@ SDL_Convert_F32_to_S32_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 #endif
 
 
+#if SDL_AVX2_INTRINSICS
+/* The AVX2 converters produce the same values as the SSE2 ones. They use
+   unaligned loads and stores instead of aligning dst first; the growing
+   conversions still walk backwards so they can work in-place. FMA isn't used:
+   it's a separate CPU feature from AVX2, and rounding once instead of twice
+   would make the results differ from the other converters. */
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = (const Sint8 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m256 divby128 = _mm256_set1_ps(DIVBY128);
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using AVX2)");
+
+    while (i >= 16) {   /* 16 * 8-bit */
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        const __m256 floats1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(bytes)), divby128);
+        const __m256 floats2 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(bytes, 8))), divby128);
+        _mm256_storeu_ps(dst + i - 16, floats1);
+        _mm256_storeu_ps(dst + i - 8, floats2);
+        i -= 16;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        i--;
+        dst[i] = ((float) src[i]) * DIVBY128;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = (const Uint8 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m256 divby128 = _mm256_set1_ps(DIVBY128);
+    const __m256 minus1 = _mm256_set1_ps(-1.0f);
+    int i = cvt->len_cvt;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using AVX2)");
+
+    while (i >= 16) {   /* 16 * 8-bit */
+        const __m128i bytes = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        const __m256 floats1 = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes)), divby128), minus1);
+        const __m256 floats2 = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8))), divby128), minus1);
+        _mm256_storeu_ps(dst + i - 16, floats1);
+        _mm256_storeu_ps(dst + i - 8, floats2);
+        i -= 16;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        i--;
+        dst[i] = (((float) src[i]) * DIVBY128) - 1.0f;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+    int i = cvt->len_cvt / sizeof (Sint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using AVX2)");
+
+    while (i >= 16) {   /* 16 * 16-bit */
+        const __m128i shorts1 = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        const __m128i shorts2 = _mm_loadu_si128((const __m128i *) (src + i - 8));
+        const __m256 floats1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts1)), divby32768);
+        const __m256 floats2 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts2)), divby32768);
+        _mm256_storeu_ps(dst + i - 16, floats1);
+        _mm256_storeu_ps(dst + i - 8, floats2);
+        i -= 16;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        i--;
+        dst[i] = ((float) src[i]) * DIVBY32768;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_U16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = (const Uint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+    const __m256 minus1 = _mm256_set1_ps(-1.0f);
+    int i = cvt->len_cvt / sizeof (Uint16);
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using AVX2)");
+
+    while (i >= 16) {   /* 16 * 16-bit */
+        const __m128i shorts1 = _mm_loadu_si128((const __m128i *) (src + i - 16));
+        const __m128i shorts2 = _mm_loadu_si128((const __m128i *) (src + i - 8));
+        const __m256 floats1 = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(shorts1)), divby32768), minus1);
+        const __m256 floats2 = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(shorts2)), divby32768), minus1);
+        _mm256_storeu_ps(dst + i - 16, floats1);
+        _mm256_storeu_ps(dst + i - 8, floats2);
+        i -= 16;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        i--;
+        dst[i] = (((float) src[i]) * DIVBY32768) - 1.0f;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_S32_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m256 divby8388607 = _mm256_set1_ps(DIVBY8388607);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (Sint32); i >= 8; i -= 8, src += 8, dst += 8) {   /* 8 * sint32 */
+        /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
+        _mm256_storeu_ps(dst, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_loadu_si256((const __m256i *) src), 8)), divby8388607));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float) (*src>>8)) * DIVBY8388607;
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+/* Loads 8 floats, clamps them to -1.0f..1.0f in the same operand order as the
+   SSE2 converters (so NaN ends up as 1.0f), scales and rounds them. */
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+SDL_ClampScaleFloats_AVX2(const float *src, const __m256 bias, const __m256 scale)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 negone = _mm256_set1_ps(-1.0f);
+    const __m256 clamped = _mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(src)), one);
+    return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_add_ps(clamped, bias), scale));
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint8 *dst = (Sint8 *) cvt->buf;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 mulby127 = _mm256_set1_ps(127.0f);
+    /* the packs work within 128-bit lanes, this puts the 4-byte groups back in order. */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (float); i >= 32; i -= 32, src += 32, dst += 32) {   /* 32 * float32 */
+        const __m256i ints1 = SDL_ClampScaleFloats_AVX2(src, zero, mulby127);
+        const __m256i ints2 = SDL_ClampScaleFloats_AVX2(src+8, zero, mulby127);
+        const __m256i ints3 = SDL_ClampScaleFloats_AVX2(src+16, zero, mulby127);
+        const __m256i ints4 = SDL_ClampScaleFloats_AVX2(src+24, zero, mulby127);
+        const __m256i bytes = _mm256_packs_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4));
+        _mm256_storeu_si256((__m256i *) dst, _mm256_permutevar8x32_epi32(bytes, order));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_U8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint8 *dst = cvt->buf;
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 mulby127 = _mm256_set1_ps(127.0f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (float); i >= 32; i -= 32, src += 32, dst += 32) {   /* 32 * float32 */
+        const __m256i ints1 = SDL_ClampScaleFloats_AVX2(src, one, mulby127);
+        const __m256i ints2 = SDL_ClampScaleFloats_AVX2(src+8, one, mulby127);
+        const __m256i ints3 = SDL_ClampScaleFloats_AVX2(src+16, one, mulby127);
+        const __m256i ints4 = SDL_ClampScaleFloats_AVX2(src+24, one, mulby127);
+        const __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(ints1, ints2), _mm256_packs_epi32(ints3, ints4));
+        _mm256_storeu_si256((__m256i *) dst, _mm256_permutevar8x32_epi32(bytes, order));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (float); i >= 16; i -= 16, src += 16, dst += 16) {   /* 16 * float32 */
+        const __m256i ints1 = SDL_ClampScaleFloats_AVX2(src, zero, mulby32767);
+        const __m256i ints2 = SDL_ClampScaleFloats_AVX2(src+8, zero, mulby32767);
+        /* pack to sint16 and put the 64-bit groups back in order across the lanes. */
+        _mm256_storeu_si256((__m256i *) dst, _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 32767;
+        } else if (sample <= -1.0f) {
+            *dst = -32768;
+        } else {
+            *dst = (Sint16)(sample * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_U16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Uint16 *dst = (Uint16 *) cvt->buf;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+    const __m256i topbit = _mm256_set1_epi16(-32768);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (float); i >= 16; i -= 16, src += 16, dst += 16) {   /* 16 * float32 */
+        /* Same signed pack and top bit flip as the SSE2 converter. */
+        const __m256i ints1 = SDL_ClampScaleFloats_AVX2(src, zero, mulby32767);
+        const __m256i ints2 = SDL_ClampScaleFloats_AVX2(src+8, zero, mulby32767);
+        const __m256i shorts = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8);
+        _mm256_storeu_si256((__m256i *) dst, _mm256_xor_si256(shorts, topbit));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+        i--; src++; dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 mulby8388607 = _mm256_set1_ps(8388607.0f);
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using AVX2)");
+
+    for (i = cvt->len_cvt / sizeof (float); i >= 8; i -= 8, src += 8, dst += 8) {   /* 8 * float32 */
+        _mm256_storeu_si256((__m256i *) dst, _mm256_slli_epi32(SDL_ClampScaleFloats_AVX2(src, zero, mulby8388607), 8));
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (Sint32) -2147483648LL;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+        i--; src++; dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+
 #if HAVE_NEON_INTRINSICS
 static void SDLCALL
 SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
@@ -1404,23 +1753,28 @@ void SDL_ChooseAudioConverters(void)
         SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
         converters_chosen = SDL_TRUE
 
+#if SDL_AVX2_INTRINSICS
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_CONVERT) & CPU_HAS_AVX2) {
+        SET_CONVERTER_FUNCS(AVX2);
+        return;
+    }
+#endif
+
 #if HAVE_SSE2_INTRINSICS
-    if (SDL_HasSSE2()) {
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_CONVERT) & CPU_HAS_SSE2) {
         SET_CONVERTER_FUNCS(SSE2);
         return;
     }
 #endif
 
 #if HAVE_NEON_INTRINSICS
-    if (SDL_HasNEON()) {
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_CONVERT) & CPU_HAS_NEON) {
         SET_CONVERTER_FUNCS(NEON);
         return;
     }
 #endif
 
-#if NEED_SCALAR_CONVERTER_FALLBACKS
     SET_CONVERTER_FUNCS(Scalar);
-#endif
 
 #undef SET_CONVERTER_FUNCS
 
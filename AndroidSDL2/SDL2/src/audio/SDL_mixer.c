@@ -26,6 +26,7 @@
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
@@ -85,15 +86,283 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* SIMD mixers for the 16-bit, 32-bit and float formats.  They process as
+ * many whole vectors as fit in len and return the number of bytes mixed;
+ * SDL_MixAudioFormat() finishes the tail with the scalar loops below.
+ * The results are bit-exact with the scalar code: products of a sample and
+ * volume/128 are exact in float (16-bit) or double (32-bit), and truncating
+ * conversions round toward zero like the integer division does.  Only the
+ * integer formats skip the scaling at SDL_MIX_MAXVOLUME: a huge float
+ * sample times 128 overflows to infinity, which the scalar code clamps.
+ */
+#ifdef __SSE2__
+#define SDL_SWAP16_SSE2(x) _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8))
+#define SDL_SWAP32_SSE2(x) SDL_SWAP16_SSE2(_mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)))
+
+static SDL_INLINE __m128i
+SDL_AddSaturate32_SSE2(const __m128i a, const __m128i b)
+{
+    const __m128i sum = _mm_add_epi32(a, b);
+    /* overflowed if a and b have the same sign and sum doesn't */
+    const __m128i overflow = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)), 31);
+    const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+    return _mm_or_si128(_mm_and_si128(overflow, saturated), _mm_andnot_si128(overflow, sum));
+}
+
+static Uint32
+SDL_MixAudio_SSE2(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                  Uint32 len, int volume)
+{
+    Uint32 i = 0;
+
+    switch (format) {
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_S16MSB);
+            const __m128 fvolume = _mm_set1_ps((float) volume / SDL_MIX_MAXVOLUME);
+
+            for (; (i + 16) <= len; i += 16) {
+                __m128i src1 = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i src2 = _mm_loadu_si128((const __m128i *) (dst + i));
+                if (swap) {
+                    src1 = SDL_SWAP16_SSE2(src1);
+                    src2 = SDL_SWAP16_SSE2(src2);
+                }
+                if (volume != SDL_MIX_MAXVOLUME) {
+                    __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(src1, src1), 16);
+                    __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(src1, src1), 16);
+                    lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), fvolume));
+                    hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), fvolume));
+                    src1 = _mm_packs_epi32(lo, hi);
+                }
+                src2 = _mm_adds_epi16(src1, src2);
+                if (swap) {
+                    src2 = SDL_SWAP16_SSE2(src2);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_S32MSB);
+            const __m128d dvolume = _mm_set1_pd((double) volume / SDL_MIX_MAXVOLUME);
+
+            for (; (i + 16) <= len; i += 16) {
+                __m128i src1 = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i src2 = _mm_loadu_si128((const __m128i *) (dst + i));
+                if (swap) {
+                    src1 = SDL_SWAP32_SSE2(src1);
+                    src2 = SDL_SWAP32_SSE2(src2);
+                }
+                if (volume != SDL_MIX_MAXVOLUME) {
+                    const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(src1), dvolume));
+                    const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(src1, src1)), dvolume));
+                    src1 = _mm_unpacklo_epi64(lo, hi);
+                }
+                src2 = SDL_AddSaturate32_SSE2(src1, src2);
+                if (swap) {
+                    src2 = SDL_SWAP32_SSE2(src2);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_F32MSB);
+            const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+            const __m128 fvolume = _mm_set1_ps((float) volume);
+            const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+            const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+
+            for (; (i + 16) <= len; i += 16) {
+                __m128i src1 = _mm_loadu_si128((const __m128i *) (src + i));
+                __m128i src2 = _mm_loadu_si128((const __m128i *) (dst + i));
+                __m128 dst_sample;
+                if (swap) {
+                    src1 = SDL_SWAP32_SSE2(src1);
+                    src2 = SDL_SWAP32_SSE2(src2);
+                }
+                dst_sample = _mm_castsi128_ps(src1);
+                dst_sample = _mm_mul_ps(_mm_mul_ps(dst_sample, fvolume), fmaxvolume);
+                dst_sample = _mm_add_ps(dst_sample, _mm_castsi128_ps(src2));
+                /* operand order keeps NaNs, like the scalar comparisons */
+                dst_sample = _mm_max_ps(min_audioval, _mm_min_ps(max_audioval, dst_sample));
+                src2 = _mm_castps_si128(dst_sample);
+                if (swap) {
+                    src2 = SDL_SWAP32_SSE2(src2);
+                }
+                _mm_storeu_si128((__m128i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#if SDL_AVX2_INTRINSICS
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+SDL_AddSaturate32_AVX2(const __m256i a, const __m256i b)
+{
+    const __m256i sum = _mm256_add_epi32(a, b);
+    const __m256i overflow = _mm256_srai_epi32(_mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, sum)), 31);
+    const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+    return _mm256_blendv_epi8(sum, saturated, overflow);
+}
+
+static Uint32 SDL_TARGETING("avx2")
+SDL_MixAudio_AVX2(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
+                  Uint32 len, int volume)
+{
+    const __m256i swap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256i swap32 = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    Uint32 i = 0;
+
+    switch (format) {
+    case AUDIO_S16LSB:
+    case AUDIO_S16MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_S16MSB);
+            const __m256 fvolume = _mm256_set1_ps((float) volume / SDL_MIX_MAXVOLUME);
+
+            for (; (i + 32) <= len; i += 32) {
+                __m256i src1 = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i src2 = _mm256_loadu_si256((const __m256i *) (dst + i));
+                if (swap) {
+                    src1 = _mm256_shuffle_epi8(src1, swap16);
+                    src2 = _mm256_shuffle_epi8(src2, swap16);
+                }
+                if (volume != SDL_MIX_MAXVOLUME) {
+                    /* unpack and pack both work within 128-bit lanes, so
+                       the samples come back out in their original order */
+                    __m256i lo = _mm256_srai_epi32(_mm256_unpacklo_epi16(src1, src1), 16);
+                    __m256i hi = _mm256_srai_epi32(_mm256_unpackhi_epi16(src1, src1), 16);
+                    lo = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), fvolume));
+                    hi = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), fvolume));
+                    src1 = _mm256_packs_epi32(lo, hi);
+                }
+                src2 = _mm256_adds_epi16(src1, src2);
+                if (swap) {
+                    src2 = _mm256_shuffle_epi8(src2, swap16);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    case AUDIO_S32LSB:
+    case AUDIO_S32MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_S32MSB);
+            const __m256d dvolume = _mm256_set1_pd((double) volume / SDL_MIX_MAXVOLUME);
+
+            for (; (i + 32) <= len; i += 32) {
+                __m256i src1 = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i src2 = _mm256_loadu_si256((const __m256i *) (dst + i));
+                if (swap) {
+                    src1 = _mm256_shuffle_epi8(src1, swap32);
+                    src2 = _mm256_shuffle_epi8(src2, swap32);
+                }
+                if (volume != SDL_MIX_MAXVOLUME) {
+                    const __m128i lo = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(src1)), dvolume));
+                    const __m128i hi = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(src1, 1)), dvolume));
+                    src1 = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+                }
+                src2 = SDL_AddSaturate32_AVX2(src1, src2);
+                if (swap) {
+                    src2 = _mm256_shuffle_epi8(src2, swap32);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    case AUDIO_F32LSB:
+    case AUDIO_F32MSB:
+        {
+            const SDL_bool swap = (format == AUDIO_F32MSB);
+            const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+            const __m256 fvolume = _mm256_set1_ps((float) volume);
+            const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+            const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+
+            for (; (i + 32) <= len; i += 32) {
+                __m256i src1 = _mm256_loadu_si256((const __m256i *) (src + i));
+                __m256i src2 = _mm256_loadu_si256((const __m256i *) (dst + i));
+                __m256 dst_sample;
+                if (swap) {
+                    src1 = _mm256_shuffle_epi8(src1, swap32);
+                    src2 = _mm256_shuffle_epi8(src2, swap32);
+                }
+                dst_sample = _mm256_castsi256_ps(src1);
+                dst_sample = _mm256_mul_ps(_mm256_mul_ps(dst_sample, fvolume), fmaxvolume);
+                dst_sample = _mm256_add_ps(dst_sample, _mm256_castsi256_ps(src2));
+                dst_sample = _mm256_max_ps(min_audioval, _mm256_min_ps(max_audioval, dst_sample));
+                src2 = _mm256_castps_si256(dst_sample);
+                if (swap) {
+                    src2 = _mm256_shuffle_epi8(src2, swap32);
+                }
+                _mm256_storeu_si256((__m256i *) (dst + i), src2);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+#ifdef __SSE2__
+    /* pick up the last 16 bytes, if there are that many left */
+    return i + SDL_MixAudio_SSE2(dst + i, src + i, format, len - i, volume);
+#else
+    return i;
+#endif
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
                    Uint32 len, int volume)
 {
+    Uint32 isas;
+    Uint32 mixed = 0;
+
     if (volume == 0) {
         return;
     }
 
+    isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_MIX);
+    (void) isas;
+#if SDL_AVX2_INTRINSICS
+    if (isas & CPU_HAS_AVX2) {
+        mixed = SDL_MixAudio_AVX2(dst, src, format, len, volume);
+    } else
+#endif
+#ifdef __SSE2__
+    if (isas & CPU_HAS_SSE2) {
+        mixed = SDL_MixAudio_SSE2(dst, src, format, len, volume);
+    }
+#endif
+    if (mixed == len) {
+        return;
+    }
+    dst += mixed;
+    src += mixed;
+    len -= mixed;
+
     switch (format) {
 
     case AUDIO_U8:
@@ -164,6 +164,7 @@ struct SDL_AudioDevice
 
     /* Queued buffers (if app not using callback). */
     SDL_DataQueue *buffer_queue;
+    SDL_bool buffer_queue_ring;  /* lock-free ring buffer, see SDL_HINT_AUDIO_QUEUE_RING_SIZE */
 
     /* * * */
     /* Data private to this driver */
@@ -0,0 +1,738 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* A mixer playing many preloaded sounds at once on one audio device.
+
+   Everything a voice does happens on the audio thread.  Other threads only
+   push commands into a lock-free ring, which the audio callback runs before
+   it mixes each buffer, so they never wait on the device lock.
+
+   Sounds are shared with the audio thread through a reference count: the
+   app holds one reference, and every voice playing the sound holds another.
+   Freed sounds are only released on the app's side, the next time a sound
+   is created or freed, so the audio thread never calls SDL_free().
+ */
+
+#include "SDL_audio.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_mutex.h"
+#include "SDL_timer.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+
+/* The number of commands that can be waiting for the audio thread */
+#define SDL_VOICE_COMMAND_RING_SIZE 1024
+
+/* Resampled voices are mixed in blocks of up to this many frames */
+#define SDL_VOICE_BLOCK_FRAMES 256
+
+/* The highest pitch a voice can be played at */
+#define SDL_VOICE_MAX_PITCH 16.0f
+
+typedef enum
+{
+    SDL_VOICE_PLAY,
+    SDL_VOICE_SET_PARAMS,
+    SDL_VOICE_STOP,
+    SDL_VOICE_STOP_ALL
+} SDL_VoiceCommandType;
+
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_VoiceCommandType type;
+    SDL_VoiceID voice;
+    SDL_MixerSound *sound;
+    float gain;
+    float pan;
+    float pitch;
+    int loops;
+} SDL_VoiceCommand;
+
+struct SDL_MixerSound
+{
+    SDL_VoiceMixer *mixer;
+    float *data;
+    int frames;
+    int channels;   /* 1 or 2 */
+    int freq;
+    SDL_atomic_t refcount;
+    SDL_bool freed;
+    SDL_MixerSound *next;
+};
+
+typedef struct
+{
+    SDL_VoiceID id;
+    SDL_MixerSound *sound;
+    Uint64 position;    /* in frames, 32.32 fixed point */
+    Uint64 step;
+    float gain_left;
+    float gain_right;
+    int loops;
+} SDL_Voice;
+
+struct SDL_VoiceMixer
+{
+    SDL_AudioDeviceID device;
+    SDL_AudioSpec spec;
+    Uint32 isas;
+
+    /* Only touched by the audio thread */
+    SDL_Voice *voices;
+    int max_voices;
+    int num_voices;
+    Uint32 dropped_voices;
+    float *scratch;
+    SDL_VoiceCommand *ring;
+    Uint32 ring_read;
+    Uint64 total_ticks;
+
+    char pad[SDL_CACHELINE_SIZE];
+    SDL_atomic_t ring_write;
+    SDL_atomic_t next_id;
+    SDL_atomic_t dropped_commands;
+
+    SDL_mutex *sounds_lock;
+    SDL_MixerSound *sounds;
+
+    SDL_SpinLock stats_lock;
+    SDL_VoiceMixerStats stats;
+};
+
+
+static SDL_bool
+SDL_ValidVoiceParams(float gain, float pitch)
+{
+    if (!(gain >= 0.0f)) {
+        SDL_InvalidParamError("gain");
+        return SDL_FALSE;
+    }
+    if (!(pitch > 0.0f && pitch <= SDL_VOICE_MAX_PITCH)) {
+        SDL_InvalidParamError("pitch");
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static void
+SDL_SetVoiceGains(const SDL_VoiceMixer *mixer, SDL_Voice *voice,
+                  float gain, float pan, float pitch)
+{
+    const SDL_MixerSound *sound = voice->sound;
+
+    pan = SDL_max(-1.0f, SDL_min(pan, 1.0f));
+    if (mixer->spec.channels == 1) {
+        /* stereo sounds are mixed down, and pan doesn't apply */
+        voice->gain_left = voice->gain_right = (sound->channels == 2) ? (gain * 0.5f) : gain;
+    } else if (sound->channels == 1) {
+        /* constant power panning */
+        const float angle = (pan + 1.0f) * (float) (M_PI / 4.0);
+        voice->gain_left = gain * SDL_cosf(angle);
+        voice->gain_right = gain * SDL_sinf(angle);
+    } else {
+        /* balance: turn down the side the sound is panned away from */
+        voice->gain_left = (pan > 0.0f) ? (gain * (1.0f - pan)) : gain;
+        voice->gain_right = (pan < 0.0f) ? (gain * (1.0f + pan)) : gain;
+    }
+    voice->step = (Uint64) (((double) sound->freq / mixer->spec.freq) * pitch * 4294967296.0);
+}
+
+static void
+SDL_RemoveVoice(SDL_VoiceMixer *mixer, int index)
+{
+    SDL_AtomicAdd(&mixer->voices[index].sound->refcount, -1);
+    mixer->voices[index] = mixer->voices[--mixer->num_voices];
+}
+
+static void
+SDL_RunVoiceCommand(SDL_VoiceMixer *mixer, const SDL_VoiceCommand *command)
+{
+    int i;
+
+    switch (command->type) {
+    case SDL_VOICE_PLAY:
+        if (mixer->num_voices == mixer->max_voices) {
+            SDL_AtomicAdd(&command->sound->refcount, -1);
+            ++mixer->dropped_voices;
+        } else {
+            SDL_Voice *voice = &mixer->voices[mixer->num_voices++];
+            voice->id = command->voice;
+            voice->sound = command->sound;
+            voice->position = 0;
+            voice->loops = command->loops;
+            SDL_SetVoiceGains(mixer, voice, command->gain, command->pan, command->pitch);
+        }
+        break;
+
+    case SDL_VOICE_SET_PARAMS:
+        for (i = 0; i < mixer->num_voices; ++i) {
+            if (mixer->voices[i].id == command->voice) {
+                SDL_SetVoiceGains(mixer, &mixer->voices[i], command->gain, command->pan, command->pitch);
+                break;
+            }
+        }
+        break;
+
+    case SDL_VOICE_STOP:
+        for (i = 0; i < mixer->num_voices; ++i) {
+            if (mixer->voices[i].id == command->voice) {
+                SDL_RemoveVoice(mixer, i);
+                break;
+            }
+        }
+        break;
+
+    case SDL_VOICE_STOP_ALL:
+        while (mixer->num_voices > 0) {
+            SDL_RemoveVoice(mixer, mixer->num_voices - 1);
+        }
+        break;
+    }
+}
+
+/* Run the commands other threads have pushed -- called on the audio thread */
+static void
+SDL_RunVoiceCommands(SDL_VoiceMixer *mixer)
+{
+    SDL_VoiceCommand *ring = mixer->ring;
+
+    for ( ; ; ) {
+        SDL_VoiceCommand *slot = &ring[mixer->ring_read & (SDL_VOICE_COMMAND_RING_SIZE - 1)];
+        if ((Uint32) SDL_AtomicGet(&slot->sequence) != mixer->ring_read + 1) {
+            break;  /* empty, or the next command is still being written */
+        }
+        SDL_MemoryBarrierAcquire();
+        SDL_RunVoiceCommand(mixer, slot);
+        SDL_MemoryBarrierRelease();
+        slot->sequence.value = (int) (mixer->ring_read + SDL_VOICE_COMMAND_RING_SIZE);
+        ++mixer->ring_read;
+    }
+}
+
+/* Push a command for the audio thread, from any thread */
+static int
+SDL_PushVoiceCommand(SDL_VoiceMixer *mixer, const SDL_VoiceCommand *command)
+{
+    SDL_VoiceCommand *slot;
+    Uint32 pos;
+
+    pos = (Uint32) SDL_AtomicGet(&mixer->ring_write);
+    for ( ; ; ) {
+        int dif;
+        slot = &mixer->ring[pos & (SDL_VOICE_COMMAND_RING_SIZE - 1)];
+        dif = (int) ((Uint32) SDL_AtomicGet(&slot->sequence) - pos);
+        if (dif == 0) {
+            if (SDL_AtomicCAS(&mixer->ring_write, (int) pos, (int) (pos + 1))) {
+                break;
+            }
+        } else if (dif < 0) {
+            SDL_AtomicAdd(&mixer->dropped_commands, 1);
+            return SDL_SetError("Voice mixer command queue is full");
+        }
+        pos = (Uint32) SDL_AtomicGet(&mixer->ring_write);
+    }
+
+    slot->type = command->type;
+    slot->voice = command->voice;
+    slot->sound = command->sound;
+    slot->gain = command->gain;
+    slot->pan = command->pan;
+    slot->pitch = command->pitch;
+    slot->loops = command->loops;
+
+    /* Only this thread writes the slot until it's published, so a plain store will do */
+    SDL_MemoryBarrierRelease();
+    slot->sequence.value = (int) (pos + 1);
+    return 0;
+}
+
+
+/* Get up to 'frames' frames of a voice, resampled to the mixer's rate.
+   Returns the number of frames, which is less than asked for at the end of
+   the sound, and 0 once the voice is done. */
+static int
+SDL_RenderVoice(SDL_Voice *voice, float *scratch, int frames, const float **output)
+{
+    const SDL_MixerSound *sound = voice->sound;
+    const int chans = sound->channels;
+    Uint32 index = (Uint32) (voice->position >> 32);
+    int i;
+
+    while (index >= (Uint32) sound->frames) {
+        if (voice->loops == 0) {
+            return 0;
+        }
+        if (voice->loops > 0) {
+            --voice->loops;
+        }
+        voice->position -= ((Uint64) sound->frames) << 32;
+        index = (Uint32) (voice->position >> 32);
+    }
+
+    if (voice->step == (((Uint64) 1) << 32) && (Uint32) voice->position == 0) {
+        /* Playing at the mixer's rate, use the sound data as it is */
+        frames = SDL_min(frames, sound->frames - (int) index);
+        *output = sound->data + (index * chans);
+        voice->position += ((Uint64) frames) << 32;
+        return frames;
+    }
+
+    for (i = 0; i < frames; ++i) {
+        const float *frame;
+        const float *next;
+        float frac;
+
+        index = (Uint32) (voice->position >> 32);
+        if (index >= (Uint32) sound->frames) {
+            break;
+        }
+        frame = sound->data + (index * chans);
+        if (index + 1 < (Uint32) sound->frames) {
+            next = frame + chans;
+        } else if (voice->loops != 0) {
+            next = sound->data;
+        } else {
+            next = frame;
+        }
+        frac = (float) ((Uint32) voice->position) * (1.0f / 4294967296.0f);
+        scratch[i * chans] = frame[0] + ((next[0] - frame[0]) * frac);
+        if (chans == 2) {
+            scratch[i * chans + 1] = frame[1] + ((next[1] - frame[1]) * frac);
+        }
+        voice->position += voice->step;
+    }
+    *output = scratch;
+    return i;
+}
+
+static void
+SDL_AccumulateVoice_Scalar(float *mix, const int outchans, const float *src,
+                           const int chans, const int frames,
+                           const float gain_left, const float gain_right)
+{
+    int i;
+
+    if (outchans == 1) {
+        if (chans == 1) {
+            for (i = 0; i < frames; ++i) {
+                mix[i] += src[i] * gain_left;
+            }
+        } else {
+            for (i = 0; i < frames; ++i) {
+                mix[i] += (src[i * 2] * gain_left) + (src[i * 2 + 1] * gain_right);
+            }
+        }
+    } else {
+        for (i = 0; i < frames; ++i) {
+            const float left = src[i * chans];
+            const float right = src[i * chans + (chans - 1)];
+            mix[i * outchans] += left * gain_left;
+            mix[i * outchans + 1] += right * gain_right;
+        }
+    }
+}
+
+#ifdef __SSE2__
+static void
+SDL_AccumulateVoice_SSE2(float *mix, const int outchans, const float *src,
+                         const int chans, const int frames,
+                         const float gain_left, const float gain_right)
+{
+    const __m128 gains = _mm_setr_ps(gain_left, gain_right, gain_left, gain_right);
+    int i = 0;
+
+    if (outchans == 1 && chans == 1) {
+        for (; (i + 4) <= frames; i += 4) {
+            _mm_storeu_ps(mix + i, _mm_add_ps(_mm_loadu_ps(mix + i), _mm_mul_ps(_mm_loadu_ps(src + i), gains)));
+        }
+    } else if (outchans == 1) {
+        for (; (i + 4) <= frames; i += 4) {
+            const __m128 a = _mm_mul_ps(_mm_loadu_ps(src + i * 2), gains);
+            const __m128 b = _mm_mul_ps(_mm_loadu_ps(src + i * 2 + 4), gains);
+            const __m128 sum = _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                                          _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+            _mm_storeu_ps(mix + i, _mm_add_ps(_mm_loadu_ps(mix + i), sum));
+        }
+    } else if (outchans == 2 && chans == 1) {
+        for (; (i + 4) <= frames; i += 4) {
+            const __m128 s = _mm_loadu_ps(src + i);
+            float *out = mix + i * 2;
+            _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_unpacklo_ps(s, s), gains)));
+            _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_unpackhi_ps(s, s), gains)));
+        }
+    } else if (outchans == 2) {
+        for (; (i + 2) <= frames; i += 2) {
+            _mm_storeu_ps(mix + i * 2, _mm_add_ps(_mm_loadu_ps(mix + i * 2), _mm_mul_ps(_mm_loadu_ps(src + i * 2), gains)));
+        }
+    }
+
+    SDL_AccumulateVoice_Scalar(mix + i * outchans, outchans, src + i * chans, chans,
+                               frames - i, gain_left, gain_right);
+}
+#endif /* __SSE2__ */
+
+static void SDLCALL
+SDL_VoiceMixerCallback(void *userdata, Uint8 *stream, int len)
+{
+    SDL_VoiceMixer *mixer = (SDL_VoiceMixer *) userdata;
+    const int outchans = mixer->spec.channels;
+    const int frames = len / (int) (sizeof (float) * outchans);
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    float *mix = (float *) stream;
+    Uint32 elapsed_us;
+    int i;
+
+    SDL_RunVoiceCommands(mixer);
+    SDL_memset(stream, 0, len);
+
+    for (i = 0; i < mixer->num_voices; ) {
+        SDL_Voice *voice = &mixer->voices[i];
+        const int chans = voice->sound->channels;
+        int done = 0;
+
+        while (done < frames) {
+            const float *src = NULL;
+            const int rendered = SDL_RenderVoice(voice, mixer->scratch, SDL_min(frames - done, SDL_VOICE_BLOCK_FRAMES), &src);
+            if (rendered == 0) {
+                break;
+            }
+#ifdef __SSE2__
+            if (mixer->isas & CPU_HAS_SSE2) {
+                SDL_AccumulateVoice_SSE2(mix + done * outchans, outchans, src, chans, rendered,
+                                         voice->gain_left, voice->gain_right);
+            } else
+#endif
+            SDL_AccumulateVoice_Scalar(mix + done * outchans, outchans, src, chans, rendered,
+                                       voice->gain_left, voice->gain_right);
+            done += rendered;
+        }
+
+        if (done < frames) {
+            SDL_RemoveVoice(mixer, i);  /* finished, the last voice moves here */
+        } else {
+            ++i;
+        }
+    }
+
+    elapsed_us = (Uint32) (((SDL_GetPerformanceCounter() - start) * 1000000) / frequency);
+    mixer->total_ticks += elapsed_us;
+
+    SDL_AtomicLock(&mixer->stats_lock);
+    ++mixer->stats.callbacks;
+    if (elapsed_us > mixer->stats.buffer_us) {
+        ++mixer->stats.glitches;
+    }
+    mixer->stats.active_voices = (Uint32) mixer->num_voices;
+    mixer->stats.dropped_voices = mixer->dropped_voices;
+    mixer->stats.last_mix_us = elapsed_us;
+    if (elapsed_us > mixer->stats.max_mix_us) {
+        mixer->stats.max_mix_us = elapsed_us;
+    }
+    mixer->stats.average_mix_us = (Uint32) (mixer->total_ticks / mixer->stats.callbacks);
+    SDL_AtomicUnlock(&mixer->stats_lock);
+}
+
+
+/* Release freed sounds no voice is playing any more -- called with the sounds locked */
+static void
+SDL_ReclaimMixerSounds(SDL_VoiceMixer *mixer, SDL_bool all)
+{
+    SDL_MixerSound **prev = &mixer->sounds;
+
+    while (*prev) {
+        SDL_MixerSound *sound = *prev;
+        if (all || (sound->freed && SDL_AtomicGet(&sound->refcount) == 0)) {
+            *prev = sound->next;
+            SDL_free(sound->data);
+            SDL_free(sound);
+        } else {
+            prev = &sound->next;
+        }
+    }
+}
+
+SDL_VoiceMixer *
+SDL_OpenVoiceMixer(const char *device, const SDL_AudioSpec *desired, int max_voices)
+{
+    SDL_VoiceMixer *mixer;
+    SDL_AudioSpec spec;
+    int i;
+
+    if (!desired) {
+        SDL_InvalidParamError("desired");
+        return NULL;
+    }
+    if (max_voices <= 0) {
+        SDL_InvalidParamError("max_voices");
+        return NULL;
+    }
+
+    mixer = (SDL_VoiceMixer *) SDL_calloc(1, sizeof (*mixer));
+    if (!mixer) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    mixer->max_voices = max_voices;
+    mixer->voices = (SDL_Voice *) SDL_calloc(max_voices, sizeof (SDL_Voice));
+    mixer->scratch = (float *) SDL_malloc(SDL_VOICE_BLOCK_FRAMES * 2 * sizeof (float));
+    mixer->ring = (SDL_VoiceCommand *) SDL_calloc(SDL_VOICE_COMMAND_RING_SIZE, sizeof (SDL_VoiceCommand));
+    if (!mixer->voices || !mixer->scratch || !mixer->ring) {
+        SDL_CloseVoiceMixer(mixer);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    mixer->sounds_lock = SDL_CreateMutex();
+    if (!mixer->sounds_lock) {
+        SDL_CloseVoiceMixer(mixer);
+        return NULL;
+    }
+    for (i = 0; i < SDL_VOICE_COMMAND_RING_SIZE; ++i) {
+        SDL_AtomicSet(&mixer->ring[i].sequence, i);
+    }
+    mixer->isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_AUDIO_MIX);
+
+    spec = *desired;
+    spec.format = AUDIO_F32SYS;
+    spec.callback = SDL_VoiceMixerCallback;
+    spec.userdata = mixer;
+    mixer->device = SDL_OpenAudioDevice(device, 0, &spec, &mixer->spec, 0);
+    if (!mixer->device) {
+        SDL_CloseVoiceMixer(mixer);
+        return NULL;
+    }
+    mixer->stats.buffer_us = (Uint32) (((Uint64) mixer->spec.samples * 1000000) / mixer->spec.freq);
+    return mixer;
+}
+
+SDL_AudioDeviceID
+SDL_GetVoiceMixerDevice(SDL_VoiceMixer *mixer)
+{
+    if (!mixer) {
+        SDL_InvalidParamError("mixer");
+        return 0;
+    }
+    return mixer->device;
+}
+
+void
+SDL_CloseVoiceMixer(SDL_VoiceMixer *mixer)
+{
+    if (!mixer) {
+        return;
+    }
+
+    if (mixer->device) {
+        SDL_CloseAudioDevice(mixer->device);
+    }
+    if (mixer->sounds_lock) {
+        SDL_LockMutex(mixer->sounds_lock);
+        SDL_ReclaimMixerSounds(mixer, SDL_TRUE);
+        SDL_UnlockMutex(mixer->sounds_lock);
+        SDL_DestroyMutex(mixer->sounds_lock);
+    }
+    SDL_free(mixer->ring);
+    SDL_free(mixer->scratch);
+    SDL_free(mixer->voices);
+    SDL_free(mixer);
+}
+
+SDL_MixerSound *
+SDL_CreateMixerSound(SDL_VoiceMixer *mixer, const SDL_AudioSpec *spec,
+                     const Uint8 *buf, Uint32 len)
+{
+    SDL_MixerSound *sound;
+    SDL_AudioCVT cvt;
+    int chans;
+
+    if (!mixer) {
+        SDL_InvalidParamError("mixer");
+        return NULL;
+    }
+    if (!spec) {
+        SDL_InvalidParamError("spec");
+        return NULL;
+    }
+    if (!buf) {
+        SDL_InvalidParamError("buf");
+        return NULL;
+    }
+
+    chans = SDL_min(spec->channels, 2);
+    if (SDL_BuildAudioCVT(&cvt, spec->format, spec->channels, spec->freq,
+                          AUDIO_F32SYS, chans, spec->freq) < 0) {
+        return NULL;
+    }
+    len -= len % ((SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels);
+    if (len == 0) {
+        SDL_SetError("Sound has no audio");
+        return NULL;
+    }
+
+    sound = (SDL_MixerSound *) SDL_calloc(1, sizeof (*sound));
+    if (!sound) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    cvt.len = (int) len;
+    cvt.buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+    if (!cvt.buf) {
+        SDL_free(sound);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_memcpy(cvt.buf, buf, len);
+    if (SDL_ConvertAudio(&cvt) < 0) {
+        SDL_free(cvt.buf);
+        SDL_free(sound);
+        return NULL;
+    }
+
+    sound->mixer = mixer;
+    sound->data = (float *) cvt.buf;
+    sound->channels = chans;
+    sound->frames = cvt.len_cvt / (int) (sizeof (float) * chans);
+    sound->freq = spec->freq;
+    SDL_AtomicSet(&sound->refcount, 1);
+
+    SDL_LockMutex(mixer->sounds_lock);
+    SDL_ReclaimMixerSounds(mixer, SDL_FALSE);
+    sound->next = mixer->sounds;
+    mixer->sounds = sound;
+    SDL_UnlockMutex(mixer->sounds_lock);
+    return sound;
+}
+
+void
+SDL_FreeMixerSound(SDL_MixerSound *sound)
+{
+    SDL_VoiceMixer *mixer;
+
+    if (!sound) {
+        return;
+    }
+
+    mixer = sound->mixer;
+    SDL_LockMutex(mixer->sounds_lock);
+    sound->freed = SDL_TRUE;
+    SDL_AtomicAdd(&sound->refcount, -1);
+    SDL_ReclaimMixerSounds(mixer, SDL_FALSE);
+    SDL_UnlockMutex(mixer->sounds_lock);
+}
+
+SDL_VoiceID
+SDL_PlayMixerSound(SDL_MixerSound *sound, float gain, float pan, float pitch, int loops)
+{
+    SDL_VoiceCommand command;
+
+    if (!sound) {
+        SDL_InvalidParamError("sound");
+        return 0;
+    }
+    if (!SDL_ValidVoiceParams(gain, pitch)) {
+        return 0;
+    }
+
+    SDL_zero(command);
+    command.type = SDL_VOICE_PLAY;
+    do {
+        command.voice = (SDL_VoiceID) (SDL_AtomicAdd(&sound->mixer->next_id, 1) + 1);
+    } while (command.voice == 0);
+    command.sound = sound;
+    command.gain = gain;
+    command.pan = pan;
+    command.pitch = pitch;
+    command.loops = loops;
+
+    SDL_AtomicAdd(&sound->refcount, 1);
+    if (SDL_PushVoiceCommand(sound->mixer, &command) < 0) {
+        SDL_AtomicAdd(&sound->refcount, -1);
+        return 0;
+    }
+    return command.voice;
+}
+
+int
+SDL_SetVoiceParams(SDL_VoiceMixer *mixer, SDL_VoiceID voice, float gain, float pan, float pitch)
+{
+    SDL_VoiceCommand command;
+
+    if (!mixer) {
+        return SDL_InvalidParamError("mixer");
+    }
+    if (!SDL_ValidVoiceParams(gain, pitch)) {
+        return -1;
+    }
+
+    SDL_zero(command);
+    command.type = SDL_VOICE_SET_PARAMS;
+    command.voice = voice;
+    command.gain = gain;
+    command.pan = pan;
+    command.pitch = pitch;
+    return SDL_PushVoiceCommand(mixer, &command);
+}
+
+int
+SDL_StopVoice(SDL_VoiceMixer *mixer, SDL_VoiceID voice)
+{
+    SDL_VoiceCommand command;
+
+    if (!mixer) {
+        return SDL_InvalidParamError("mixer");
+    }
+
+    SDL_zero(command);
+    command.type = SDL_VOICE_STOP;
+    command.voice = voice;
+    return SDL_PushVoiceCommand(mixer, &command);
+}
+
+int
+SDL_StopAllVoices(SDL_VoiceMixer *mixer)
+{
+    SDL_VoiceCommand command;
+
+    if (!mixer) {
+        return SDL_InvalidParamError("mixer");
+    }
+
+    SDL_zero(command);
+    command.type = SDL_VOICE_STOP_ALL;
+    return SDL_PushVoiceCommand(mixer, &command);
+}
+
+void
+SDL_GetVoiceMixerStats(SDL_VoiceMixer *mixer, SDL_VoiceMixerStats *stats)
+{
+    if (!mixer || !stats) {
+        return;
+    }
+
+    SDL_AtomicLock(&mixer->stats_lock);
+    *stats = mixer->stats;
+    SDL_AtomicUnlock(&mixer->stats_lock);
+    stats->dropped_commands = (Uint32) SDL_AtomicGet(&mixer->dropped_commands);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
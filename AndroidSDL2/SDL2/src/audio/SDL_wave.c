@@ -1167,8 +1167,11 @@ LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Expands sample_count companded bytes at the start of buf to 16-bit samples,
+ * in place. buf must have room for sample_count Sint16 values.
+ */
 static int
-LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+LAW_Expand(Uint16 encoding, Uint8 *buf, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1208,54 +1211,15 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
     };
 #endif
-
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return -1;
-        }
-    }
-
-    /* Nothing to decode, nothing to return. */
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return 0;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_OutOfMemory();
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_OutOfMemory();
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (src == NULL) {
-        return SDL_OutOfMemory();
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+    const Uint8 *src = buf;
+    Sint16 *dst = (Sint16 *)buf;
+    size_t i;
 
     /* Work backwards, since we're expanding in-place. SDL_AudioSpec.format will
      * inform the caller about the byte order.
      */
     i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1300,10 +1264,59 @@ LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return 0;
+}
+
+static int
+LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+    }
+
+    /* Nothing to decode, nothing to return. */
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return 0;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_OutOfMemory();
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_OutOfMemory();
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (src == NULL) {
+        return SDL_OutOfMemory();
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    if (LAW_Expand(format->encoding, src, sample_count) < 0) {
+        SDL_free(src);
+        return -1;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1353,12 +1366,37 @@ PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts sample_count 24-bit samples at the start of ptr to 32 bits, in place.
+ * ptr must have room for sample_count Sint32 values.
+ */
+static void
+PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int
 PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1386,21 +1424,7 @@ PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return 0;
 }
@@ -1784,8 +1808,13 @@ WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Parses the RIFF structure and the fmt chunk, and fills in the SDL_AudioSpec
+ * the decoded data will have. Leaves the data chunk description in file->chunk
+ * without reading any of its data and reports the position after the RIFF
+ * chunk in endposition.
+ */
 static int
-WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+WaveLoadHeader(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1998,9 +2027,73 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
 
     WaveFreeChunkData(chunk);
 
-    /* Process data chunk. */
+    /* The data chunk is read by the caller. */
     *chunk = datachunk;
 
+    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    SDL_zerop(spec);
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->samples = 4096;       /* Good default buffer size */
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = AUDIO_S16SYS;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = AUDIO_F32LSB;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = AUDIO_U8;
+            break;
+        case 16:
+            spec->format = AUDIO_S16LSB;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = AUDIO_S32LSB;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    }
+
+    spec->silence = SDL_SilenceValueForFormat(spec->format);
+
+    /* Report the end position back to the cleanup code. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+static int
+WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    SDL_AudioSpec wavespec;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (WaveLoadHeader(src, file, &wavespec, &endposition) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
@@ -2044,52 +2137,10 @@ WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf,
         break;
     }
 
-    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    SDL_zerop(spec);
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->samples = 4096;       /* Good default buffer size */
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = AUDIO_S16SYS;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = AUDIO_F32LSB;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16LSB;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = AUDIO_S32LSB;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    }
-
-    spec->silence = SDL_SilenceValueForFormat(spec->format);
+    *spec = wavespec;
 
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
@@ -2153,4 +2204,366 @@ SDL_FreeWAV(Uint8 *audio_buf)
     SDL_free(audio_buf);
 }
 
+/* WAVE streaming. Uncompressed data is read straight into the caller's buffer
+ * and expanded in place if necessary. ADPCM data is decoded one block at a
+ * time into a buffer that holds the samples of a single block.
+ */
+struct SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFile file;
+    Sint64 endposition;   /* Position after the RIFF chunk. */
+    Sint64 srcposition;   /* Current position of src, -1 if unknown. */
+    Sint64 framepos;      /* Next sample frame returned by a read. */
+    size_t framesize;     /* Size of a decoded sample frame in bytes. */
+
+    /* ADPCM block decoding. */
+    ADPCM_DecoderState state;
+    Uint8 *blockdata;
+    Sint16 *blockframes;
+    void *cstate;
+    Sint64 blockindex;    /* Block in blockframes, -1 if none. */
+    size_t blockframecount;
+};
+
+static int
+WaveStreamSeekSource(SDL_WAVStream *stream, Sint64 position)
+{
+    if (stream->srcposition != position) {
+        if (SDL_RWseek(stream->src, position, RW_SEEK_SET) != position) {
+            stream->srcposition = -1;
+            return SDL_SetError("Could not seek data of WAVE data chunk");
+        }
+        stream->srcposition = position;
+    }
+    return 0;
+}
+
+static size_t
+WaveStreamReadSource(SDL_WAVStream *stream, void *buf, size_t length)
+{
+    const size_t read = SDL_RWread(stream->src, buf, 1, length);
+    stream->srcposition += read;
+    return read;
+}
+
+static int
+WaveStreamDecodeBlock(SDL_WAVStream *stream, Sint64 block)
+{
+    WaveFile *file = &stream->file;
+    ADPCM_DecoderState *state = &stream->state;
+    const Sint64 offset = block * (Sint64)state->blocksize;
+    size_t length, expected;
+    int result;
+
+    stream->blockindex = -1;
+    stream->blockframecount = 0;
+
+    /* The last block may be shorter if the data chunk length says so. */
+    if (offset >= file->chunk.length) {
+        return 0;
+    }
+    expected = (size_t)SDL_min((Sint64)state->blocksize, file->chunk.length - offset);
+
+    if (WaveStreamSeekSource(stream, file->chunk.position + offset) < 0) {
+        return -1;
+    }
+    length = WaveStreamReadSource(stream, stream->blockdata, expected);
+    if (length != expected) {
+        /* I/O issues or corrupt file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+        /* Recalculate number of sample frames like the whole file decoders do. */
+        if (file->format.encoding == MS_ADPCM_CODE) {
+            result = MS_ADPCM_CalculateSampleFrames(file, (size_t)offset + length);
+        } else {
+            result = IMA_ADPCM_CalculateSampleFrames(file, (size_t)offset + length);
+        }
+        if (result < 0) {
+            return -1;
+        }
+    }
+    if (length < state->blockheadersize) {
+        /* Not even a block header. This is where the data ends. */
+        file->sampleframes = SDL_min(file->sampleframes, block * state->samplesperblock);
+        return 0;
+    }
+
+    state->block.data = stream->blockdata;
+    state->block.size = length;
+    state->block.pos = 0;
+    state->output.data = stream->blockframes;
+    state->output.size = state->samplesperblock * state->channels;
+    state->output.pos = 0;
+    state->framesleft = file->sampleframes - block * state->samplesperblock;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        result = MS_ADPCM_DecodeBlockHeader(state);
+        if (result == -1) {
+            return -1;
+        }
+        result = MS_ADPCM_DecodeBlockData(state);
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(state);
+        if (result == 0) {
+            result = IMA_ADPCM_DecodeBlockData(state);
+        }
+    }
+
+    if (result == -1) {
+        /* Unexpected end. Keep partial data if necessary and end the stream here. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            state->output.pos -= state->output.pos % (state->samplesperblock * state->channels);
+        }
+        file->sampleframes = block * state->samplesperblock + state->output.pos / state->channels;
+    }
+
+    stream->blockindex = block;
+    stream->blockframecount = state->output.pos / state->channels;
+
+    return 0;
+}
+
+static int
+WaveStreamReadADPCM(SDL_WAVStream *stream, Uint8 *buf, size_t frames)
+{
+    WaveFile *file = &stream->file;
+    const Sint64 samplesperblock = stream->state.samplesperblock;
+    size_t total = 0;
+
+    while (total < frames && stream->framepos < file->sampleframes) {
+        const Sint64 block = stream->framepos / samplesperblock;
+        size_t first, count;
+
+        if (block != stream->blockindex) {
+            if (WaveStreamDecodeBlock(stream, block) < 0) {
+                return -1;
+            }
+        }
+
+        first = (size_t)(stream->framepos - block * samplesperblock);
+        if (first >= stream->blockframecount || stream->framepos >= file->sampleframes) {
+            break;
+        }
+        count = SDL_min(stream->blockframecount - first, frames - total);
+        count = (size_t)SDL_min((Sint64)count, file->sampleframes - stream->framepos);
+
+        SDL_memcpy(buf + total * stream->framesize, stream->blockframes + first * stream->state.channels, count * stream->framesize);
+        total += count;
+        stream->framepos += count;
+    }
+
+    return (int)(total * stream->framesize);
+}
+
+static int
+WaveStreamReadPCM(SDL_WAVStream *stream, Uint8 *buf, size_t frames)
+{
+    WaveFile *file = &stream->file;
+    WaveFormat *format = &file->format;
+    const Sint64 offset = stream->framepos * format->blockalign;
+    size_t length, read;
+
+    if (stream->framepos >= file->sampleframes) {
+        return 0;
+    }
+    frames = (size_t)SDL_min((Sint64)frames, file->sampleframes - stream->framepos);
+
+    if (WaveStreamSeekSource(stream, file->chunk.position + offset) < 0) {
+        return -1;
+    }
+
+    /* The encoded frames are never larger than the decoded ones. */
+    length = frames * format->blockalign;
+    read = WaveStreamReadSource(stream, buf, length);
+    if (read != length) {
+        /* I/O issues or corrupt file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+        /* Recalculate number of sample frames like the whole file decoders do. */
+        file->sampleframes = WaveAdjustToFactValue(file, (offset + read) / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+        frames = (size_t)SDL_max(0, SDL_min((Sint64)frames, file->sampleframes - stream->framepos));
+    }
+
+    switch (format->encoding) {
+    case ALAW_CODE:
+    case MULAW_CODE:
+        if (LAW_Expand(format->encoding, buf, frames * format->channels) < 0) {
+            return -1;
+        }
+        break;
+    case PCM_CODE:
+        if (format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(buf, frames * format->channels);
+        }
+        break;
+    }
+
+    stream->framepos += frames;
+
+    return (int)(frames * stream->framesize);
+}
+
+static void
+WaveFreeStream(SDL_WAVStream *stream)
+{
+    WaveFreeChunkData(&stream->file.chunk);
+    SDL_free(stream->file.decoderdata);
+    SDL_free(stream->blockdata);
+    SDL_free(stream->blockframes);
+    SDL_free(stream->cstate);
+    SDL_free(stream);
+}
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec)
+{
+    SDL_WAVStream *stream;
+    WaveFormat *format;
+
+    /* Make sure we are passed a valid data source */
+    if (src == NULL) {
+        /* Error may come from RWops. */
+        return NULL;
+    } else if (spec == NULL) {
+        SDL_InvalidParamError("spec");
+        goto failed;
+    }
+
+    stream = (SDL_WAVStream *)SDL_calloc(1, sizeof(SDL_WAVStream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        goto failed;
+    }
+
+    stream->src = src;
+    stream->freesrc = freesrc;
+    stream->srcposition = -1;
+    stream->blockindex = -1;
+    stream->file.riffhint = WaveGetRiffSizeHint();
+    stream->file.trunchint = WaveGetTruncationHint();
+    stream->file.facthint = WaveGetFactChunkHint();
+
+    if (WaveLoadHeader(src, &stream->file, spec, &stream->endposition) < 0) {
+        WaveFreeStream(stream);
+        goto failed;
+    }
+
+    format = &stream->file.format;
+    stream->framesize = (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels;
+
+    if (format->encoding == MS_ADPCM_CODE || format->encoding == IMA_ADPCM_CODE) {
+        ADPCM_DecoderState *state = &stream->state;
+
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = stream->framesize;
+        state->ddata = stream->file.decoderdata;
+        state->framestotal = stream->file.sampleframes;
+        if (format->encoding == MS_ADPCM_CODE) {
+            state->blockheadersize = (size_t)state->channels * 7;
+            stream->cstate = SDL_calloc(2, sizeof(MS_ADPCM_ChannelState));
+        } else {
+            state->blockheadersize = (size_t)state->channels * 4;
+            stream->cstate = SDL_calloc(state->channels, sizeof(Sint8));
+        }
+        state->cstate = stream->cstate;
+
+        stream->blockdata = (Uint8 *)SDL_malloc(state->blocksize);
+        stream->blockframes = (Sint16 *)SDL_malloc(state->samplesperblock * stream->framesize);
+        if (stream->cstate == NULL || stream->blockdata == NULL || stream->blockframes == NULL) {
+            WaveFreeStream(stream);
+            SDL_OutOfMemory();
+            goto failed;
+        }
+    }
+
+    return stream;
+
+failed:
+    if (freesrc) {
+        SDL_RWclose(src);
+    }
+    return NULL;
+}
+
+int
+SDL_ReadWAVStream(SDL_WAVStream *stream, void *buf, int len)
+{
+    size_t frames;
+
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if (buf == NULL) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    frames = (size_t)len / stream->framesize;
+    switch (stream->file.format.encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        return WaveStreamReadADPCM(stream, (Uint8 *)buf, frames);
+    default:
+        return WaveStreamReadPCM(stream, (Uint8 *)buf, frames);
+    }
+}
+
+int
+SDL_SeekWAVStream(SDL_WAVStream *stream, Sint64 frame)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if (frame < 0) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    /* The block containing the frame gets decoded by the next read. */
+    stream->framepos = SDL_min(frame, stream->file.sampleframes);
+    return 0;
+}
+
+Sint64
+SDL_TellWAVStream(SDL_WAVStream *stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->framepos;
+}
+
+Sint64
+SDL_GetWAVStreamLength(SDL_WAVStream *stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->file.sampleframes;
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream *stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+
+    if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    } else {
+        SDL_RWseek(stream->src, stream->endposition, RW_SEEK_SET);
+    }
+    WaveFreeStream(stream);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -39,6 +39,10 @@
 
 #include "SDL_cpuinfo.h"
 #include "SDL_assert.h"
+#include "SDL_cpuinfo_c.h"
+#ifndef TEST_MAIN
+#include "SDL_hints.h"
+#endif
 
 #ifdef HAVE_SYSCONF
 #include <unistd.h>
@@ -95,21 +99,6 @@
 #include <swis.h>
 #endif
 
-#define CPU_HAS_RDTSC   (1 << 0)
-#define CPU_HAS_ALTIVEC (1 << 1)
-#define CPU_HAS_MMX     (1 << 2)
-#define CPU_HAS_3DNOW   (1 << 3)
-#define CPU_HAS_SSE     (1 << 4)
-#define CPU_HAS_SSE2    (1 << 5)
-#define CPU_HAS_SSE3    (1 << 6)
-#define CPU_HAS_SSE41   (1 << 7)
-#define CPU_HAS_SSE42   (1 << 8)
-#define CPU_HAS_AVX     (1 << 9)
-#define CPU_HAS_AVX2    (1 << 10)
-#define CPU_HAS_NEON    (1 << 11)
-#define CPU_HAS_AVX512F (1 << 12)
-#define CPU_HAS_ARM_SIMD (1 << 13)
-
 #if SDL_ALTIVEC_BLITTERS && HAVE_SETJMP && !__MACOSX__ && !__OpenBSD__
 /* This is the brute force way of detecting instruction sets...
    the idea is borrowed from the libmpeg2 library - thanks!
@@ -712,6 +701,42 @@ SDL_GetCPUCacheLineSize(void)
     }
 }
 
+static int SDL_CPUCacheSize = 0;
+
+int
+SDL_GetCPUCacheSize(void)
+{
+    if (!SDL_CPUCacheSize) {
+#if defined(HAVE_SYSCONF) && defined(_SC_LEVEL3_CACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+        long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (size <= 0) {
+            size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        }
+        if (size > 0 && size <= SDL_MAX_SINT32) {
+            SDL_CPUCacheSize = (int) size;
+        }
+#endif
+        if (SDL_CPUCacheSize <= 0) {
+            const char *cpuType = SDL_GetCPUType();
+            if (SDL_strcmp(cpuType, "AuthenticAMD") == 0 || SDL_strcmp(cpuType, "HygonGenuine") == 0) {
+                int a, b, c, d;
+                (void) a; (void) b; (void) c; (void) d;
+                cpuid(0x80000006, a, b, c, d);
+                /* L3 in 512K units, else L2 in 1K units */
+                SDL_CPUCacheSize = ((d >> 18) & 0x3fff) * 512 * 1024;
+                if (SDL_CPUCacheSize <= 0) {
+                    SDL_CPUCacheSize = ((c >> 16) & 0xffff) * 1024;
+                }
+            }
+        }
+        if (SDL_CPUCacheSize <= 0) {
+            /* Just make a guess here... */
+            SDL_CPUCacheSize = 4 * 1024 * 1024;
+        }
+    }
+    return SDL_CPUCacheSize;
+}
+
 static Uint32 SDL_CPUFeatures = 0xFFFFFFFF;
 static Uint32 SDL_SIMDAlignment = 0xFFFFFFFF;
 
@@ -866,6 +891,202 @@ SDL_HasNEON(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_NEON);
 }
 
+/* Instruction sets each kernel family was built with. These follow the #ifs
+   around the kernels themselves, so keep them in step.
+ */
+#ifdef __MMX__
+#define KERNEL_MMX CPU_HAS_MMX
+#else
+#define KERNEL_MMX 0
+#endif
+#ifdef __3dNOW__
+#define KERNEL_3DNOW CPU_HAS_3DNOW
+#else
+#define KERNEL_3DNOW 0
+#endif
+#ifdef __SSE__
+#define KERNEL_SSE CPU_HAS_SSE
+#else
+#define KERNEL_SSE 0
+#endif
+#ifdef __SSE2__
+#define KERNEL_SSE2 CPU_HAS_SSE2
+#else
+#define KERNEL_SSE2 0
+#endif
+#ifdef __SSE3__
+#define KERNEL_SSE3 CPU_HAS_SSE3
+#else
+#define KERNEL_SSE3 0
+#endif
+#if SDL_SSE4_1_INTRINSICS
+#define KERNEL_SSE41 CPU_HAS_SSE41
+#else
+#define KERNEL_SSE41 0
+#endif
+#if SDL_AVX2_INTRINSICS
+#define KERNEL_AVX2 CPU_HAS_AVX2
+#else
+#define KERNEL_AVX2 0
+#endif
+#ifdef __ARM_NEON
+#define KERNEL_NEON CPU_HAS_NEON
+#else
+#define KERNEL_NEON 0
+#endif
+#if SDL_ARM_NEON_BLITTERS
+#define KERNEL_NEON_BLITTERS CPU_HAS_NEON
+#else
+#define KERNEL_NEON_BLITTERS 0
+#endif
+#if SDL_ARM_SIMD_BLITTERS
+#define KERNEL_ARM_SIMD_BLITTERS CPU_HAS_ARM_SIMD
+#else
+#define KERNEL_ARM_SIMD_BLITTERS 0
+#endif
+#if SDL_ALTIVEC_BLITTERS
+#define KERNEL_ALTIVEC_BLITTERS CPU_HAS_ALTIVEC
+#else
+#define KERNEL_ALTIVEC_BLITTERS 0
+#endif
+
+static const struct
+{
+    const char *name;
+    Uint32 isas;
+} SDL_CPUKernels[SDL_CPU_KERNEL_COUNT] = {
+    { "blit.copy", KERNEL_SSE | KERNEL_MMX },
+    { "blit.alpha", KERNEL_AVX2 | KERNEL_SSE41 | KERNEL_3DNOW | KERNEL_MMX | KERNEL_NEON_BLITTERS | KERNEL_ARM_SIMD_BLITTERS },
+    { "blit.convert", KERNEL_AVX2 | KERNEL_SSE41 | KERNEL_ALTIVEC_BLITTERS | KERNEL_ARM_SIMD_BLITTERS },
+    { "blit.auto", KERNEL_AVX2 | KERNEL_SSE2 },
+    { "fill", KERNEL_SSE | KERNEL_NEON_BLITTERS | KERNEL_ARM_SIMD_BLITTERS },
+    { "stretch", KERNEL_AVX2 | KERNEL_SSE2 },
+    { "rotate", KERNEL_SSE2 },
+    { "yuv", KERNEL_SSE2 },
+    { "audio.convert", KERNEL_AVX2 | KERNEL_SSE2 | KERNEL_NEON },
+    { "audio.channels", KERNEL_SSE },
+    { "audio.resample", KERNEL_AVX2 | KERNEL_SSE },
+    { "audio.mix", KERNEL_AVX2 | KERNEL_SSE2 }
+};
+
+/* Instruction sets from most to least preferred, with what naming each one
+   in SDL_HINT_CPU_FEATURE_MASK allows.
+ */
+#define CPU_UPTO_MMX        (CPU_HAS_MMX)
+#define CPU_UPTO_SSE        (CPU_UPTO_MMX | CPU_HAS_SSE)
+#define CPU_UPTO_SSE2       (CPU_UPTO_SSE | CPU_HAS_SSE2)
+#define CPU_UPTO_SSE3       (CPU_UPTO_SSE2 | CPU_HAS_SSE3)
+#define CPU_UPTO_SSE41      (CPU_UPTO_SSE3 | CPU_HAS_SSE41)
+#define CPU_UPTO_SSE42      (CPU_UPTO_SSE41 | CPU_HAS_SSE42)
+#define CPU_UPTO_AVX        (CPU_UPTO_SSE42 | CPU_HAS_AVX)
+#define CPU_UPTO_AVX2       (CPU_UPTO_AVX | CPU_HAS_AVX2)
+#define CPU_UPTO_AVX512F    (CPU_UPTO_AVX2 | CPU_HAS_AVX512F)
+
+static const struct
+{
+    Uint32 isa;
+    const char *name;
+    Uint32 allows;
+} SDL_CPUISAs[] = {
+    { CPU_HAS_AVX512F, "AVX512F", CPU_UPTO_AVX512F },
+    { CPU_HAS_AVX2, "AVX2", CPU_UPTO_AVX2 },
+    { CPU_HAS_AVX, "AVX", CPU_UPTO_AVX },
+    { CPU_HAS_SSE42, "SSE4.2", CPU_UPTO_SSE42 },
+    { CPU_HAS_SSE41, "SSE4.1", CPU_UPTO_SSE41 },
+    { CPU_HAS_SSE3, "SSE3", CPU_UPTO_SSE3 },
+    { CPU_HAS_SSE2, "SSE2", CPU_UPTO_SSE2 },
+    { CPU_HAS_SSE, "SSE", CPU_UPTO_SSE },
+    { CPU_HAS_3DNOW, "3DNow", CPU_HAS_3DNOW | CPU_UPTO_MMX },
+    { CPU_HAS_MMX, "MMX", CPU_UPTO_MMX },
+    { CPU_HAS_NEON, "NEON", CPU_HAS_NEON },
+    { CPU_HAS_ARM_SIMD, "ARMSIMD", CPU_HAS_ARM_SIMD },
+    { CPU_HAS_ALTIVEC, "AltiVec", CPU_HAS_ALTIVEC }
+};
+
+static SDL_bool SDL_CPUDispatchReady = SDL_FALSE;
+static Uint32 SDL_CPUDispatch[SDL_CPU_KERNEL_COUNT];
+
+static Uint32
+SDL_GetCPUFeatureMask(void)
+{
+    const char *hint = NULL;
+    Uint32 mask = 0;
+
+#ifndef TEST_MAIN
+    hint = SDL_GetHint(SDL_HINT_CPU_FEATURE_MASK);
+#endif
+    if (!hint || !*hint) {
+        return 0xFFFFFFFF;
+    }
+
+    /* A comma separated list like "sse2" or "avx2,neon", anything else is ignored */
+    while (*hint) {
+        const char *end = hint;
+        size_t len;
+        int i;
+
+        while (*end && *end != ',' && *end != ' ') {
+            ++end;
+        }
+        len = (size_t) (end - hint);
+        for (i = 0; i < SDL_arraysize(SDL_CPUISAs); ++i) {
+            const char *name = SDL_CPUISAs[i].name;
+            if (len && SDL_strlen(name) == len && SDL_strncasecmp(hint, name, len) == 0) {
+                mask |= SDL_CPUISAs[i].allows;
+            }
+        }
+        hint = *end ? end + 1 : end;
+    }
+    return mask;
+}
+
+Uint32
+SDL_GetCPUDispatch(SDL_CPUKernel kernel)
+{
+    if (!SDL_CPUDispatchReady) {
+        const Uint32 features = SDL_GetCPUFeatures() & SDL_GetCPUFeatureMask();
+        int i;
+
+        for (i = 0; i < SDL_CPU_KERNEL_COUNT; ++i) {
+            SDL_CPUDispatch[i] = SDL_CPUKernels[i].isas & features;
+        }
+        SDL_CPUDispatchReady = SDL_TRUE;
+    }
+    return SDL_CPUDispatch[kernel];
+}
+
+int
+SDL_GetNumCPUDispatchKernels(void)
+{
+    return SDL_CPU_KERNEL_COUNT;
+}
+
+const char *
+SDL_GetCPUDispatchKernel(int index)
+{
+    if (index >= 0 && index < SDL_CPU_KERNEL_COUNT) {
+        return SDL_CPUKernels[index].name;
+    }
+    return NULL;
+}
+
+const char *
+SDL_GetCPUDispatchImplementation(int index)
+{
+    if (index >= 0 && index < SDL_CPU_KERNEL_COUNT) {
+        const Uint32 isas = SDL_GetCPUDispatch((SDL_CPUKernel) index);
+        int i;
+
+        for (i = 0; i < SDL_arraysize(SDL_CPUISAs); ++i) {
+            if (isas & SDL_CPUISAs[i].isa) {
+                return SDL_CPUISAs[i].name;
+            }
+        }
+        return "C";
+    }
+    return NULL;
+}
+
 static int SDL_SystemRAM = 0;
 
 int
@@ -993,6 +1214,12 @@ main()
     printf("ARM SIMD: %d\n", SDL_HasARMSIMD());
     printf("NEON: %d\n", SDL_HasNEON());
     printf("RAM: %d MB\n", SDL_GetSystemRAM());
+    {
+        int i;
+        for (i = 0; i < SDL_GetNumCPUDispatchKernels(); ++i) {
+            printf("%s: %s\n", SDL_GetCPUDispatchKernel(i), SDL_GetCPUDispatchImplementation(i));
+        }
+    }
     return 0;
 }
 
@@ -0,0 +1,71 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_cpuinfo_c_h_
+#define SDL_cpuinfo_c_h_
+
+#include "SDL_stdinc.h"
+
+#define CPU_HAS_RDTSC   (1 << 0)
+#define CPU_HAS_ALTIVEC (1 << 1)
+#define CPU_HAS_MMX     (1 << 2)
+#define CPU_HAS_3DNOW   (1 << 3)
+#define CPU_HAS_SSE     (1 << 4)
+#define CPU_HAS_SSE2    (1 << 5)
+#define CPU_HAS_SSE3    (1 << 6)
+#define CPU_HAS_SSE41   (1 << 7)
+#define CPU_HAS_SSE42   (1 << 8)
+#define CPU_HAS_AVX     (1 << 9)
+#define CPU_HAS_AVX2    (1 << 10)
+#define CPU_HAS_NEON    (1 << 11)
+#define CPU_HAS_AVX512F (1 << 12)
+#define CPU_HAS_ARM_SIMD (1 << 13)
+
+/* Returns the size in bytes of the largest CPU cache, or a guess at it */
+extern int SDL_GetCPUCacheSize(void);
+
+/* The families of SIMD kernels SDL picks an implementation for at runtime */
+typedef enum
+{
+    SDL_CPU_KERNEL_BLIT_COPY,       /* SDL_blit_copy.c */
+    SDL_CPU_KERNEL_BLIT_ALPHA,      /* SDL_blit_A.c */
+    SDL_CPU_KERNEL_BLIT_CONVERT,    /* SDL_blit_N.c */
+    SDL_CPU_KERNEL_BLIT_AUTO,       /* SDL_blit_auto.c */
+    SDL_CPU_KERNEL_FILL,            /* SDL_fillrect.c */
+    SDL_CPU_KERNEL_STRETCH,         /* SDL_stretch.c */
+    SDL_CPU_KERNEL_ROTATE,          /* SDL_rotate.c */
+    SDL_CPU_KERNEL_YUV,             /* SDL_yuv.c */
+    SDL_CPU_KERNEL_AUDIO_CONVERT,   /* SDL_audiotypecvt.c */
+    SDL_CPU_KERNEL_AUDIO_CHANNELS,  /* SDL_audiocvt.c channel conversion */
+    SDL_CPU_KERNEL_AUDIO_RESAMPLE,  /* SDL_audiocvt.c resampler */
+    SDL_CPU_KERNEL_AUDIO_MIX,       /* SDL_mixer.c, SDL_voicemixer.c */
+    SDL_CPU_KERNEL_COUNT
+} SDL_CPUKernel;
+
+/* Returns the CPU_HAS_* instruction sets a kernel family may use: the ones
+   it was built with, that the CPU has and that SDL_HINT_CPU_FEATURE_MASK
+   allows. This is worked out once, the first time any kernel asks.
+ */
+extern Uint32 SDL_GetCPUDispatch(SDL_CPUKernel kernel);
+
+#endif /* SDL_cpuinfo_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
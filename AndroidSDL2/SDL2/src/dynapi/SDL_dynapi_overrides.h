@@ -749,3 +749,41 @@
 #define SDL_GetAndroidSDKVersion SDL_GetAndroidSDKVersion_REAL
 #define SDL_isupper SDL_isupper_REAL
 #define SDL_islower SDL_islower_REAL
+#define SDL_SoftStretchLinear SDL_SoftStretchLinear_REAL
+#define SDL_GetNumCPUDispatchKernels SDL_GetNumCPUDispatchKernels_REAL
+#define SDL_GetCPUDispatchKernel SDL_GetCPUDispatchKernel_REAL
+#define SDL_GetCPUDispatchImplementation SDL_GetCPUDispatchImplementation_REAL
+#define SDL_RenderCopyBatch SDL_RenderCopyBatch_REAL
+#define SDL_RenderBeginList SDL_RenderBeginList_REAL
+#define SDL_RenderEndList SDL_RenderEndList_REAL
+#define SDL_RenderReplayList SDL_RenderReplayList_REAL
+#define SDL_DestroyRenderList SDL_DestroyRenderList_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetThreadCacheMemoryFunctions SDL_GetThreadCacheMemoryFunctions_REAL
+#define SDL_GetThreadCacheMemoryStats SDL_GetThreadCacheMemoryStats_REAL
+#define SDL_OpenVoiceMixer SDL_OpenVoiceMixer_REAL
+#define SDL_GetVoiceMixerDevice SDL_GetVoiceMixerDevice_REAL
+#define SDL_CloseVoiceMixer SDL_CloseVoiceMixer_REAL
+#define SDL_CreateMixerSound SDL_CreateMixerSound_REAL
+#define SDL_FreeMixerSound SDL_FreeMixerSound_REAL
+#define SDL_PlayMixerSound SDL_PlayMixerSound_REAL
+#define SDL_SetVoiceParams SDL_SetVoiceParams_REAL
+#define SDL_StopVoice SDL_StopVoice_REAL
+#define SDL_StopAllVoices SDL_StopAllVoices_REAL
+#define SDL_GetVoiceMixerStats SDL_GetVoiceMixerStats_REAL
+#define SDL_OpenWAVStream_RW SDL_OpenWAVStream_RW_REAL
+#define SDL_ReadWAVStream SDL_ReadWAVStream_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_TellWAVStream SDL_TellWAVStream_REAL
+#define SDL_GetWAVStreamLength SDL_GetWAVStreamLength_REAL
+#define SDL_CloseWAVStream SDL_CloseWAVStream_REAL
+#define SDL_RWFromMappedFile SDL_RWFromMappedFile_REAL
+#define SDL_RWGetMemory SDL_RWGetMemory_REAL
+#define SDL_CreateAsyncIOQueue SDL_CreateAsyncIOQueue_REAL
+#define SDL_DestroyAsyncIOQueue SDL_DestroyAsyncIOQueue_REAL
+#define SDL_AsyncRead SDL_AsyncRead_REAL
+#define SDL_AsyncReadBatch SDL_AsyncReadBatch_REAL
+#define SDL_CancelAsyncIO SDL_CancelAsyncIO_REAL
+#define SDL_GetAsyncIOResult SDL_GetAsyncIOResult_REAL
+#define SDL_WaitAsyncIOResult SDL_WaitAsyncIOResult_REAL
+#define SDL_GetAsyncIOOutstanding SDL_GetAsyncIOOutstanding_REAL
@@ -809,3 +809,41 @@ SDL_DYNAPI_PROC(int,SDL_GetAndroidSDKVersion,(void),(),return)
 #endif
 SDL_DYNAPI_PROC(int,SDL_isupper,(int a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_islower,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SoftStretchLinear,(SDL_Surface *a, const SDL_Rect *b, SDL_Surface *c, const SDL_Rect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumCPUDispatchKernels,(void),(),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetCPUDispatchKernel,(int a),(a),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetCPUDispatchImplementation,(int a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderCopyBatch,(SDL_Renderer *a, SDL_Texture *b, const SDL_RenderCopyItem *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_RenderBeginList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RenderList*,SDL_RenderEndList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderReplayList,(SDL_Renderer *a, SDL_RenderList *b, int c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRenderList,(SDL_RenderList *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_PollEvents,(SDL_Event *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_GetThreadCacheMemoryFunctions,(SDL_malloc_func *a, SDL_calloc_func *b, SDL_realloc_func *c, SDL_free_func *d),(a,b,c,d),)
+SDL_DYNAPI_PROC(int,SDL_GetThreadCacheMemoryStats,(SDL_MemoryCacheStats *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_VoiceMixer*,SDL_OpenVoiceMixer,(const char *a, const SDL_AudioSpec *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioDeviceID,SDL_GetVoiceMixerDevice,(SDL_VoiceMixer *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseVoiceMixer,(SDL_VoiceMixer *a),(a),)
+SDL_DYNAPI_PROC(SDL_MixerSound*,SDL_CreateMixerSound,(SDL_VoiceMixer *a, const SDL_AudioSpec *b, const Uint8 *c, Uint32 d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_FreeMixerSound,(SDL_MixerSound *a),(a),)
+SDL_DYNAPI_PROC(SDL_VoiceID,SDL_PlayMixerSound,(SDL_MixerSound *a, float b, float c, float d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_SetVoiceParams,(SDL_VoiceMixer *a, SDL_VoiceID b, float c, float d, float e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_StopVoice,(SDL_VoiceMixer *a, SDL_VoiceID b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_StopAllVoices,(SDL_VoiceMixer *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_GetVoiceMixerStats,(SDL_VoiceMixer *a, SDL_VoiceMixerStats *b),(a,b),)
+SDL_DYNAPI_PROC(SDL_WAVStream*,SDL_OpenWAVStream_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWAVStream,(SDL_WAVStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SeekWAVStream,(SDL_WAVStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_TellWAVStream,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetWAVStreamLength,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVStream,(SDL_WAVStream *a),(a),)
+SDL_DYNAPI_PROC(SDL_RWops*,SDL_RWFromMappedFile,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const void*,SDL_RWGetMemory,(SDL_RWops *a, size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AsyncIOQueue*,SDL_CreateAsyncIOQueue,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAsyncIOQueue,(SDL_AsyncIOQueue *a),(a),)
+SDL_DYNAPI_PROC(SDL_AsyncIOID,SDL_AsyncRead,(SDL_AsyncIOQueue *a, const SDL_AsyncReadRequest *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AsyncReadBatch,(SDL_AsyncIOQueue *a, const SDL_AsyncReadRequest *b, int c, SDL_AsyncIOID *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_CancelAsyncIO,(SDL_AsyncIOQueue *a, SDL_AsyncIOID b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_GetAsyncIOResult,(SDL_AsyncIOQueue *a, SDL_AsyncIOOutcome *b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_WaitAsyncIOResult,(SDL_AsyncIOQueue *a, SDL_AsyncIOOutcome *b, Sint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetAsyncIOOutstanding,(SDL_AsyncIOQueue *a),(a),return)
@@ -26,6 +26,7 @@
 #include "SDL_events.h"
 #include "SDL_thread.h"
 #include "SDL_events_c.h"
+#include "../SDL_hints_c.h"
 #include "../timer/SDL_timer_c.h"
 #if !SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
@@ -43,6 +44,10 @@
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS   65535
 
+/* Number of events other threads can push without taking the queue lock,
+   must be a power of two */
+#define SDL_EVENT_RING_SIZE     1024
+
 typedef struct SDL_EventWatcher {
     SDL_EventFilter callback;
     void *userdata;
@@ -63,33 +68,55 @@ typedef struct {
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static Uint32 SDL_userevents = SDL_USEREVENT;
 
-/* Private data -- event queue */
-typedef struct _SDL_EventEntry
-{
-    SDL_Event event;
-    SDL_SysWMmsg msg;
-    struct _SDL_EventEntry *prev;
-    struct _SDL_EventEntry *next;
-} SDL_EventEntry;
+/* Private data -- event queue
 
+   Events are pushed into a lock-free ring, which can take events from any
+   number of threads at once. Whoever holds the queue lock is the only reader
+   of the ring, and moves the events from it to the end of the queue proper
+   before looking at the queue. Events that carry a window manager message,
+   and events that don't fit in the ring, are added with the lock held.
+
+   The queue proper is a circular array. Events removed from the middle of it
+   are only marked as such, and skipped until they reach the head.
+ */
 typedef struct _SDL_SysWMEntry
 {
     SDL_SysWMmsg msg;
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+typedef struct
+{
+    SDL_Event event;
+    SDL_SysWMEntry *wmmsg;
+    SDL_bool removed;
+} SDL_EventEntry;
+
+typedef struct
+{
+    SDL_atomic_t sequence;      /* position it can be written at, or that position + 1 once it's written */
+    SDL_Event event;
+} SDL_EventSlot;
+
 static struct
 {
     SDL_mutex *lock;
     SDL_atomic_t active;
     SDL_atomic_t count;
     int max_events_seen;
-    SDL_EventEntry *head;
-    SDL_EventEntry *tail;
-    SDL_EventEntry *free;
+    SDL_EventEntry *entries;
+    Uint32 entries_mask;
+    Uint32 head;
+    Uint32 tail;
+    int num_removed;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+
+    SDL_EventSlot *ring;
+    Uint32 ring_read;
+    char pad[SDL_CACHELINE_SIZE];
+    SDL_atomic_t ring_write;
+} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, 0, 0, 0, 0, NULL, NULL, NULL, 0, { 0 }, { 0 } };
 
 
 /* 0 (default) means no logging, 1 means logging, 2 means logging with mouse and finger motion */
@@ -101,6 +128,14 @@ SDL_EventLoggingChanged(void *userdata, const char *name, const char *oldValue,
     SDL_DoEventLogging = (hint && *hint) ? SDL_max(SDL_min(SDL_atoi(hint), 2), 0) : 0;
 }
 
+static SDL_bool SDL_CoalesceMotion = SDL_FALSE;
+
+static void SDLCALL
+SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_CoalesceMotion = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
 static void
 SDL_LogEvent(const SDL_Event *event)
 {
@@ -348,7 +383,6 @@ SDL_StopEventLoop(void)
 {
     const char *report = SDL_GetHint("SDL_EVENT_QUEUE_STATISTICS");
     int i;
-    SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
 
     if (SDL_EventQ.lock) {
@@ -363,16 +397,11 @@ SDL_StopEventLoop(void)
     }
 
     /* Clean out EventQ */
-    for (entry = SDL_EventQ.head; entry; ) {
-        SDL_EventEntry *next = entry->next;
-        SDL_free(entry);
-        entry = next;
-    }
-    for (entry = SDL_EventQ.free; entry; ) {
-        SDL_EventEntry *next = entry->next;
-        SDL_free(entry);
-        entry = next;
+    for ( ; SDL_EventQ.head != SDL_EventQ.tail; ++SDL_EventQ.head) {
+        SDL_free(SDL_EventQ.entries[SDL_EventQ.head & SDL_EventQ.entries_mask].wmmsg);
     }
+    SDL_free(SDL_EventQ.entries);
+    SDL_free(SDL_EventQ.ring);
     for (wmmsg = SDL_EventQ.wmmsg_used; wmmsg; ) {
         SDL_SysWMEntry *next = wmmsg->next;
         SDL_free(wmmsg);
@@ -386,9 +415,14 @@ SDL_StopEventLoop(void)
 
     SDL_AtomicSet(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
-    SDL_EventQ.head = NULL;
-    SDL_EventQ.tail = NULL;
-    SDL_EventQ.free = NULL;
+    SDL_EventQ.entries = NULL;
+    SDL_EventQ.entries_mask = 0;
+    SDL_EventQ.head = 0;
+    SDL_EventQ.tail = 0;
+    SDL_EventQ.num_removed = 0;
+    SDL_EventQ.ring = NULL;
+    SDL_EventQ.ring_read = 0;
+    SDL_AtomicSet(&SDL_EventQ.ring_write, 0);
     SDL_EventQ.wmmsg_used = NULL;
     SDL_EventQ.wmmsg_free = NULL;
 
@@ -441,6 +475,21 @@ SDL_StartEventLoop(void)
             return -1;
         }
     }
+
+    if (!SDL_EventQ.ring) {
+        SDL_EventSlot *ring = (SDL_EventSlot *) SDL_malloc(SDL_EVENT_RING_SIZE * sizeof (*ring));
+        if (ring) {
+            /* Without the ring, every event goes through the lock */
+            int i;
+            for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+                SDL_AtomicSet(&ring[i].sequence, i);
+            }
+            SDL_EventQ.ring_read = 0;
+            SDL_AtomicSet(&SDL_EventQ.ring_write, 0);
+            SDL_MemoryBarrierRelease();
+            SDL_EventQ.ring = ring;
+        }
+    }
 #endif /* !SDL_THREADS_DISABLED */
 
     /* Process most event types */
@@ -458,56 +507,249 @@ SDL_StartEventLoop(void)
 }
 
 
+/* Make room for one more entry at the tail -- called with the queue locked.
+   Entries keep their positions, so the queue can be walked while this happens. */
+static SDL_bool
+SDL_GrowEventEntries(void)
+{
+    const Uint32 capacity = SDL_EventQ.entries ? (SDL_EventQ.entries_mask + 1) : 0;
+    const Uint32 new_capacity = capacity ? (capacity * 2) : 128;
+    SDL_EventEntry *entries;
+    Uint32 pos;
+
+    if ((SDL_EventQ.tail - SDL_EventQ.head) < capacity) {
+        return SDL_TRUE;
+    }
+
+    entries = (SDL_EventEntry *) SDL_malloc(new_capacity * sizeof (*entries));
+    if (!entries) {
+        SDL_OutOfMemory();
+        return SDL_FALSE;
+    }
+    for (pos = SDL_EventQ.head; pos != SDL_EventQ.tail; ++pos) {
+        entries[pos & (new_capacity - 1)] = SDL_EventQ.entries[pos & SDL_EventQ.entries_mask];
+    }
+    SDL_free(SDL_EventQ.entries);
+    SDL_EventQ.entries = entries;
+    SDL_EventQ.entries_mask = new_capacity - 1;
+    return SDL_TRUE;
+}
+
+/* Merge a motion event into the last event in the queue, if that is motion
+   from the same device -- called with the queue locked */
+static SDL_bool
+SDL_CoalesceEvent(const SDL_Event *event)
+{
+    SDL_EventEntry *last;
+
+    if (!SDL_CoalesceMotion || SDL_EventQ.head == SDL_EventQ.tail) {
+        return SDL_FALSE;
+    }
+    last = &SDL_EventQ.entries[(SDL_EventQ.tail - 1) & SDL_EventQ.entries_mask];
+    if (last->removed || last->event.type != event->type) {
+        return SDL_FALSE;
+    }
+
+    switch (event->type) {
+    case SDL_MOUSEMOTION: {
+        SDL_MouseMotionEvent *motion = &last->event.motion;
+        if (motion->windowID != event->motion.windowID ||
+            motion->which != event->motion.which ||
+            motion->state != event->motion.state) {
+            return SDL_FALSE;
+        }
+        motion->timestamp = event->motion.timestamp;
+        motion->x = event->motion.x;
+        motion->y = event->motion.y;
+        motion->xrel += event->motion.xrel;
+        motion->yrel += event->motion.yrel;
+        return SDL_TRUE;
+    }
+
+    case SDL_FINGERMOTION: {
+        SDL_TouchFingerEvent *finger = &last->event.tfinger;
+        if (finger->touchId != event->tfinger.touchId ||
+            finger->fingerId != event->tfinger.fingerId ||
+            finger->windowID != event->tfinger.windowID) {
+            return SDL_FALSE;
+        }
+        finger->timestamp = event->tfinger.timestamp;
+        finger->x = event->tfinger.x;
+        finger->y = event->tfinger.y;
+        finger->dx += event->tfinger.dx;
+        finger->dy += event->tfinger.dy;
+        finger->pressure = event->tfinger.pressure;
+        return SDL_TRUE;
+    }
+
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Append an event to the queue -- called with the queue locked */
+static SDL_bool
+SDL_AppendEventEntry(const SDL_Event *event, SDL_SysWMEntry *wmmsg)
+{
+    SDL_EventEntry *entry;
+
+    if (!SDL_GrowEventEntries()) {
+        return SDL_FALSE;
+    }
+
+    entry = &SDL_EventQ.entries[SDL_EventQ.tail++ & SDL_EventQ.entries_mask];
+    entry->event = *event;
+    entry->wmmsg = wmmsg;
+    entry->removed = SDL_FALSE;
+    if (wmmsg) {
+        entry->event.syswm.msg = &wmmsg->msg;
+    }
+    return SDL_TRUE;
+}
+
+/* Move the events other threads pushed to the queue -- called with the queue locked.
+   If 'wait' is set, events that are still being written are waited for, so that
+   anything added with the lock held afterwards ends up behind them. */
+static void
+SDL_DrainEventRing(SDL_bool wait)
+{
+    SDL_EventSlot *ring = SDL_EventQ.ring;
+    int drained = 0;
+
+    if (!ring) {
+        return;
+    }
+
+    for ( ; ; ) {
+        SDL_EventSlot *slot = &ring[SDL_EventQ.ring_read & (SDL_EVENT_RING_SIZE - 1)];
+        if ((Uint32) SDL_AtomicGet(&slot->sequence) != SDL_EventQ.ring_read + 1) {
+            /* empty, or the next event is still being written */
+            if (wait && (int) ((Uint32) SDL_AtomicGet(&SDL_EventQ.ring_write) - SDL_EventQ.ring_read) > 0) {
+                SDL_Delay(0);
+                continue;
+            }
+            break;
+        }
+        SDL_MemoryBarrierAcquire();
+        if (SDL_CoalesceEvent(&slot->event)) {
+            /* merged into the previous event */
+        } else if (SDL_AppendEventEntry(&slot->event, NULL)) {
+            ++drained;
+        } else {
+            break;
+        }
+        SDL_MemoryBarrierRelease();
+        slot->sequence.value = (int) (SDL_EventQ.ring_read + SDL_EVENT_RING_SIZE);
+        ++SDL_EventQ.ring_read;
+    }
+
+    if (drained) {
+        const int count = SDL_AtomicAdd(&SDL_EventQ.count, drained) + drained;
+        if (count > SDL_EventQ.max_events_seen) {
+            SDL_EventQ.max_events_seen = count;
+        }
+    }
+}
+
+/* Push an event without taking the queue lock.
+   Returns -1 if the event has to be added with the lock held instead.
+
+   Events in the ring aren't counted until they're moved to the queue, so the
+   queue may go over SDL_MAX_QUEUED_EVENTS by up to SDL_EVENT_RING_SIZE events.
+   Like the locked path, this can't be used while the event loop is shutting down. */
+static int
+SDL_PushEventRing(SDL_Event * event)
+{
+    SDL_EventSlot *ring = SDL_EventQ.ring;
+    SDL_EventSlot *slot;
+    Uint32 pos;
+
+    if (!ring || event->type == SDL_SYSWMEVENT) {
+        return -1;
+    }
+
+    if (SDL_AtomicGet(&SDL_EventQ.count) >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_SetError("Event queue is full (%d events)", SDL_AtomicGet(&SDL_EventQ.count));
+        return 0;
+    }
+
+    pos = (Uint32) SDL_AtomicGet(&SDL_EventQ.ring_write);
+    for ( ; ; ) {
+        int dif;
+        slot = &ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        dif = (int) ((Uint32) SDL_AtomicGet(&slot->sequence) - pos);
+        if (dif == 0) {
+            if (SDL_AtomicCAS(&SDL_EventQ.ring_write, (int) pos, (int) (pos + 1))) {
+                break;
+            }
+        } else if (dif < 0) {
+            return -1;  /* the ring is full */
+        }
+        pos = (Uint32) SDL_AtomicGet(&SDL_EventQ.ring_write);
+    }
+
+    slot->event = *event;
+
+    /* Only this thread writes the slot until it's published, so a plain store will do */
+    SDL_MemoryBarrierRelease();
+    slot->sequence.value = (int) (pos + 1);
+
+    /* Log from the caller's copy once the slot is published, so a slow log
+       doesn't hold up the thread draining the ring */
+    if (SDL_DoEventLogging) {
+        SDL_LogEvent(event);
+    }
+    return 1;
+}
+
 /* Add an event to the event queue -- called with the queue locked */
 static int
 SDL_AddEvent(SDL_Event * event)
 {
-    SDL_EventEntry *entry;
+    SDL_SysWMEntry *wmmsg = NULL;
     const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
+
+    if (SDL_CoalesceEvent(event)) {
+        if (SDL_DoEventLogging) {
+            SDL_LogEvent(event);
+        }
+        return 1;
+    }
 
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (!entry) {
-            return 0;
+    if (event->type == SDL_SYSWMEVENT) {
+        if (SDL_EventQ.wmmsg_free) {
+            wmmsg = SDL_EventQ.wmmsg_free;
+            SDL_EventQ.wmmsg_free = wmmsg->next;
+        } else {
+            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
+            if (!wmmsg) {
+                return 0;
+            }
         }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+        wmmsg->msg = *event->syswm.msg;
     }
 
     if (SDL_DoEventLogging) {
         SDL_LogEvent(event);
     }
 
-    entry->event = *event;
-    if (event->type == SDL_SYSWMEVENT) {
-        entry->msg = *event->syswm.msg;
-        entry->event.syswm.msg = &entry->msg;
-    }
-
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
+    if (!SDL_AppendEventEntry(event, wmmsg)) {
+        if (wmmsg) {
+            wmmsg->next = SDL_EventQ.wmmsg_free;
+            SDL_EventQ.wmmsg_free = wmmsg;
+        }
+        return 0;
     }
 
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+    if ((initial_count + 1) > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = initial_count + 1;
     }
+    SDL_AtomicAdd(&SDL_EventQ.count, 1);
 
     return 1;
 }
@@ -516,28 +758,48 @@ SDL_AddEvent(SDL_Event * event)
 static void
 SDL_CutEvent(SDL_EventEntry *entry)
 {
-    if (entry->prev) {
-        entry->prev->next = entry->next;
-    }
-    if (entry->next) {
-        entry->next->prev = entry->prev;
-    }
+    SDL_assert(!entry->removed);
 
-    if (entry == SDL_EventQ.head) {
-        SDL_assert(entry->prev == NULL);
-        SDL_EventQ.head = entry->next;
-    }
-    if (entry == SDL_EventQ.tail) {
-        SDL_assert(entry->next == NULL);
-        SDL_EventQ.tail = entry->prev;
+    if (entry->wmmsg) {
+        entry->wmmsg->next = SDL_EventQ.wmmsg_free;
+        SDL_EventQ.wmmsg_free = entry->wmmsg;
+        entry->wmmsg = NULL;
     }
+    entry->removed = SDL_TRUE;
+    ++SDL_EventQ.num_removed;
 
-    entry->next = SDL_EventQ.free;
-    SDL_EventQ.free = entry;
     SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
     SDL_AtomicAdd(&SDL_EventQ.count, -1);
 }
 
+/* Drop the removed events from the queue -- called with the queue locked */
+static void
+SDL_TrimEvents(void)
+{
+    while (SDL_EventQ.head != SDL_EventQ.tail &&
+           SDL_EventQ.entries[SDL_EventQ.head & SDL_EventQ.entries_mask].removed) {
+        ++SDL_EventQ.head;
+        --SDL_EventQ.num_removed;
+    }
+
+    /* Squeeze out the ones in the middle once they take up half the queue */
+    if (SDL_EventQ.num_removed > 32 &&
+        (Uint32) SDL_EventQ.num_removed > (SDL_EventQ.tail - SDL_EventQ.head) / 2) {
+        Uint32 pos, keep = SDL_EventQ.head;
+        for (pos = SDL_EventQ.head; pos != SDL_EventQ.tail; ++pos) {
+            const SDL_EventEntry *entry = &SDL_EventQ.entries[pos & SDL_EventQ.entries_mask];
+            if (!entry->removed) {
+                if (keep != pos) {
+                    SDL_EventQ.entries[keep & SDL_EventQ.entries_mask] = *entry;
+                }
+                ++keep;
+            }
+        }
+        SDL_EventQ.tail = keep;
+        SDL_EventQ.num_removed = 0;
+    }
+}
+
 /* Lock the event queue, take a peep at it, and unlock it */
 int
 SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
@@ -553,17 +815,37 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
-    /* Lock the event queue */
+
     used = 0;
+
+    /* Most events can be added without waiting for the lock */
+    if (action == SDL_ADDEVENT) {
+        for (i = 0; i < numevents; ++i) {
+            const int added = SDL_PushEventRing(&events[i]);
+            if (added < 0) {
+                break;
+            }
+            used += added;
+        }
+        if (i == numevents) {
+            return used;
+        }
+        events += i;
+        numevents -= i;
+    }
+
+    /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+        /* Keep the events in the order they were pushed */
+        SDL_DrainEventRing(action == SDL_ADDEVENT);
+
         if (action == SDL_ADDEVENT) {
             for (i = 0; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
         } else {
-            SDL_EventEntry *entry, *next;
             SDL_SysWMEntry *wmmsg, *wmmsg_next;
-            Uint32 type;
+            Uint32 pos, type;
 
             if (action == SDL_GETEVENT) {
                 /* Clean out any used wmmsg data
@@ -577,27 +859,40 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                 SDL_EventQ.wmmsg_used = NULL;
             }
 
-            for (entry = SDL_EventQ.head; entry && (!events || used < numevents); entry = next) {
-                next = entry->next;
+            for (pos = SDL_EventQ.head; pos != SDL_EventQ.tail && (!events || used < numevents); ++pos) {
+                SDL_EventEntry *entry = &SDL_EventQ.entries[pos & SDL_EventQ.entries_mask];
+                if (entry->removed) {
+                    continue;
+                }
                 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
                     if (events) {
                         events[used] = entry->event;
-                        if (entry->event.type == SDL_SYSWMEVENT) {
+                        if (entry->wmmsg) {
                             /* We need to copy the wmmsg somewhere safe.
                                For now we'll guarantee it's valid at least until
                                the next call to SDL_PeepEvents()
                              */
-                            if (SDL_EventQ.wmmsg_free) {
+                            if (action == SDL_GETEVENT) {
+                                wmmsg = entry->wmmsg;  /* the queued copy leaves with the event */
+                                entry->wmmsg = NULL;
+                            } else if (SDL_EventQ.wmmsg_free) {
                                 wmmsg = SDL_EventQ.wmmsg_free;
                                 SDL_EventQ.wmmsg_free = wmmsg->next;
+                                wmmsg->msg = entry->wmmsg->msg;
                             } else {
                                 wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
+                                if (wmmsg) {
+                                    wmmsg->msg = entry->wmmsg->msg;
+                                }
+                            }
+                            if (wmmsg) {
+                                wmmsg->next = SDL_EventQ.wmmsg_used;
+                                SDL_EventQ.wmmsg_used = wmmsg;
+                                events[used].syswm.msg = &wmmsg->msg;
+                            } else {
+                                events[used].syswm.msg = NULL;
                             }
-                            wmmsg->msg = *entry->event.syswm.msg;
-                            wmmsg->next = SDL_EventQ.wmmsg_used;
-                            SDL_EventQ.wmmsg_used = wmmsg;
-                            events[used].syswm.msg = &wmmsg->msg;
                         }
 
                         if (action == SDL_GETEVENT) {
@@ -607,6 +902,10 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                     ++used;
                 }
             }
+
+            if (action == SDL_GETEVENT) {
+                SDL_TrimEvents();
+            }
         }
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
@@ -657,15 +956,16 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 
     /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        SDL_EventEntry *entry, *next;
-        Uint32 type;
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
+        Uint32 pos, type;
+        SDL_DrainEventRing(SDL_FALSE);
+        for (pos = SDL_EventQ.head; pos != SDL_EventQ.tail; ++pos) {
+            SDL_EventEntry *entry = &SDL_EventQ.entries[pos & SDL_EventQ.entries_mask];
             type = entry->event.type;
-            if (minType <= type && type <= maxType) {
+            if (!entry->removed && minType <= type && type <= maxType) {
                 SDL_CutEvent(entry);
             }
         }
+        SDL_TrimEvents();
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
         }
@@ -707,6 +1007,13 @@ SDL_PollEvent(SDL_Event * event)
     return SDL_WaitEventTimeout(event, 0);
 }
 
+int
+SDL_PollEvents(SDL_Event * events, int maxevents)
+{
+    SDL_PumpEvents();
+    return SDL_PeepEvents(events, maxevents, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+}
+
 int
 SDL_WaitEvent(SDL_Event * event)
 {
@@ -892,13 +1199,22 @@ void
 SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
-        SDL_EventEntry *entry, *next;
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
-            if (!filter(userdata, &entry->event)) {
-                SDL_CutEvent(entry);
+        Uint32 pos;
+        SDL_DrainEventRing(SDL_FALSE);
+        /* The filter can push events, which may move the entries around */
+        for (pos = SDL_EventQ.head; pos != SDL_EventQ.tail; ++pos) {
+            SDL_Event event;
+            if (SDL_EventQ.entries[pos & SDL_EventQ.entries_mask].removed) {
+                continue;
+            }
+            event = SDL_EventQ.entries[pos & SDL_EventQ.entries_mask].event;
+            if (!filter(userdata, &event)) {
+                SDL_CutEvent(&SDL_EventQ.entries[pos & SDL_EventQ.entries_mask]);
+            } else {
+                SDL_EventQ.entries[pos & SDL_EventQ.entries_mask].event = event;
             }
         }
+        SDL_TrimEvents();
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
         }
@@ -1009,7 +1325,9 @@ int
 SDL_EventsInit(void)
 {
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
+        SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
         return -1;
     }
@@ -1024,6 +1342,7 @@ SDL_EventsQuit(void)
 {
     SDL_QuitQuit();
     SDL_StopEventLoop();
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 }
 
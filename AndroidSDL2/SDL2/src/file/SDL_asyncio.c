@@ -0,0 +1,783 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Asynchronous file reads, served by a small pool of I/O threads that all
+   queues share. Every request ends up on its queue's completion list
+   exactly once, whether it was read, failed or cancelled. */
+
+#include "SDL_rwops.h"
+#include "SDL_events.h"
+#include "SDL_hints.h"
+#include "SDL_atomic.h"
+#include "SDL_mutex.h"
+#include "SDL_timer.h"
+#include "../thread/SDL_systhread.h"
+
+#define ASYNCIO_DEFAULT_THREADS 4
+#define ASYNCIO_MAX_THREADS     64
+#define ASYNCIO_NUM_PRIORITIES  (SDL_ASYNCIO_PRIORITY_HIGH + 1)
+
+/* Pending requests for the same file are read together, in offset order,
+   through one SDL_RWops. */
+#define ASYNCIO_MAX_BATCH       16
+
+/* Reads are split into chunks this big, so cancelling a large read takes
+   effect without waiting for the whole thing. */
+#define ASYNCIO_CHUNK_SIZE      (1024 * 1024)
+
+typedef struct SDL_AsyncIOTask
+{
+    SDL_AsyncIOID id;
+    SDL_AsyncIOQueue *queue;
+    char *file;
+    Sint64 offset;
+    size_t length;
+    void *buffer;
+    SDL_bool allocated;
+    int priority;
+    void *userdata;
+    SDL_AsyncIOResult result;
+    size_t transferred;
+    SDL_atomic_t cancelled;
+    struct SDL_AsyncIOTask *next;
+} SDL_AsyncIOTask;
+
+struct SDL_AsyncIOQueue
+{
+    Uint32 event_type;
+    SDL_cond *done;                 /* signalled when a request completes */
+    SDL_AsyncIOTask *completed;
+    SDL_AsyncIOTask *completed_tail;
+    int outstanding;                /* submitted, not yet completed */
+    int busy;                       /* completed, but still being posted */
+};
+
+/* The pool exists while any queue does. Everything in it is protected by
+   pool.lock, except the thread list, which only changes under
+   pool_init_mutex when the first queue is created or the last destroyed. */
+static struct
+{
+    SDL_mutex *lock;
+    SDL_cond *wake;
+    SDL_Thread *threads[ASYNCIO_MAX_THREADS];
+    int num_threads;
+    int num_queues;
+    SDL_bool shutdown;
+    SDL_AsyncIOTask *pending[ASYNCIO_NUM_PRIORITIES];
+    SDL_AsyncIOTask *pending_tail[ASYNCIO_NUM_PRIORITIES];
+    SDL_AsyncIOTask *running;
+    SDL_AsyncIOID next_id;
+} pool;
+
+static SDL_mutex *pool_init_mutex;
+
+/* Starting and stopping the pool creates and joins threads, so the lock
+   for it is a real mutex, created on first use. */
+static int
+LockPoolInit(void)
+{
+    if (!pool_init_mutex) {
+        static SDL_SpinLock pool_init_lock;
+        SDL_AtomicLock(&pool_init_lock);
+        if (!pool_init_mutex) {
+            SDL_mutex *mutex = SDL_CreateMutex();
+            SDL_MemoryBarrierRelease();
+            pool_init_mutex = mutex;
+            if (!pool_init_mutex) {
+                SDL_AtomicUnlock(&pool_init_lock);
+                return -1;
+            }
+        }
+        SDL_AtomicUnlock(&pool_init_lock);
+    }
+    SDL_MemoryBarrierAcquire();
+    return SDL_LockMutex(pool_init_mutex);
+}
+
+
+static void
+FreeTask(SDL_AsyncIOTask *task, SDL_bool free_buffer)
+{
+    if (free_buffer && task->allocated) {
+        SDL_free(task->buffer);
+    }
+    SDL_free(task->file);
+    SDL_free(task);
+}
+
+/* pool.lock must be held */
+static void
+AppendCompleted(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIOQueue *queue = task->queue;
+
+    task->next = NULL;
+    if (queue->completed_tail) {
+        queue->completed_tail->next = task;
+    } else {
+        queue->completed = task;
+    }
+    queue->completed_tail = task;
+}
+
+static void
+PostCompletionEvent(Uint32 event_type, SDL_AsyncIOQueue *queue,
+                    SDL_AsyncIOID id, void *userdata)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = event_type;
+    event.user.timestamp = SDL_GetTicks();
+    event.user.code = (Sint32) id;
+    event.user.data1 = queue;
+    event.user.data2 = userdata;
+    SDL_PushEvent(&event);
+}
+
+/* Takes the first request of the highest priority, plus any pending
+   requests of the same priority for the same file. pool.lock must be held. */
+static int
+TakeBatch(SDL_AsyncIOTask **batch)
+{
+    SDL_AsyncIOTask *task, *prev;
+    int priority, count, i, j;
+
+    for (priority = ASYNCIO_NUM_PRIORITIES - 1; priority >= 0; priority--) {
+        if (pool.pending[priority]) {
+            break;
+        }
+    }
+    if (priority < 0) {
+        return 0;
+    }
+
+    task = pool.pending[priority];
+    pool.pending[priority] = task->next;
+    batch[0] = task;
+    count = 1;
+
+    prev = NULL;
+    task = pool.pending[priority];
+    while (task && (count < ASYNCIO_MAX_BATCH)) {
+        SDL_AsyncIOTask *next = task->next;
+        if (SDL_strcmp(task->file, batch[0]->file) == 0) {
+            if (prev) {
+                prev->next = next;
+            } else {
+                pool.pending[priority] = next;
+            }
+            if (pool.pending_tail[priority] == task) {
+                pool.pending_tail[priority] = prev;
+            }
+            batch[count++] = task;
+        } else {
+            prev = task;
+        }
+        task = next;
+    }
+
+    if (!pool.pending[priority]) {
+        pool.pending_tail[priority] = NULL;
+    }
+
+    /* Sort by offset, so the file is read front to back. */
+    for (i = 1; i < count; i++) {
+        task = batch[i];
+        for (j = i; (j > 0) && (batch[j - 1]->offset > task->offset); j--) {
+            batch[j] = batch[j - 1];
+        }
+        batch[j] = task;
+    }
+
+    for (i = 0; i < count; i++) {
+        batch[i]->next = pool.running;
+        pool.running = batch[i];
+    }
+    return count;
+}
+
+static void
+ReadTask(SDL_RWops *rw, SDL_AsyncIOTask *task)
+{
+    Uint8 *buffer;
+    size_t length = task->length;
+
+    task->result = SDL_ASYNCIO_FAILURE;
+
+    if (!length) {  /* the rest of the file */
+        const Sint64 size = SDL_RWsize(rw);
+        if (size < 0) {
+            return;
+        }
+        if (size > task->offset) {
+            if ((Uint64) (size - task->offset) >= (Uint64) ((size_t) -1)) {
+                return;
+            }
+            length = (size_t) (size - task->offset);
+        }
+        task->length = length;
+    }
+
+    if (SDL_RWseek(rw, task->offset, RW_SEEK_SET) != task->offset) {
+        return;
+    }
+
+    if (!task->buffer) {
+        /* One extra byte for a terminating zero, as SDL_LoadFile() does. */
+        task->buffer = SDL_malloc(length + 1);
+        if (!task->buffer) {
+            return;
+        }
+        task->allocated = SDL_TRUE;
+    }
+
+    buffer = (Uint8 *) task->buffer;
+    while (task->transferred < length) {
+        const size_t chunk = SDL_min(length - task->transferred, ASYNCIO_CHUNK_SIZE);
+        size_t size_read;
+
+        if (SDL_AtomicGet(&task->cancelled)) {
+            task->result = SDL_ASYNCIO_CANCELLED;
+            return;
+        }
+        size_read = SDL_RWread(rw, buffer + task->transferred, 1, chunk);
+        if (size_read == 0) {
+            break;  /* end of file */
+        }
+        task->transferred += size_read;
+    }
+
+    if (task->allocated) {
+        buffer[task->transferred] = '\0';
+    }
+    task->result = SDL_ASYNCIO_COMPLETE;
+}
+
+static void
+RunBatch(SDL_AsyncIOTask **batch, int count)
+{
+    SDL_RWops *rw = NULL;
+    SDL_bool opened = SDL_FALSE;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        SDL_AsyncIOTask *task = batch[i];
+
+        if (SDL_AtomicGet(&task->cancelled)) {
+            task->result = SDL_ASYNCIO_CANCELLED;
+            continue;
+        }
+        if (!opened) {
+            rw = SDL_RWFromFile(task->file, "rb");
+            opened = SDL_TRUE;
+        }
+        if (!rw) {
+            task->result = SDL_ASYNCIO_FAILURE;
+            continue;
+        }
+        ReadTask(rw, task);
+    }
+
+    if (rw) {
+        SDL_RWclose(rw);
+    }
+
+    /* Don't hand back half-filled buffers that SDL allocated. */
+    for (i = 0; i < count; i++) {
+        SDL_AsyncIOTask *task = batch[i];
+        if (task->allocated && (task->result != SDL_ASYNCIO_COMPLETE)) {
+            SDL_free(task->buffer);
+            task->buffer = NULL;
+            task->allocated = SDL_FALSE;
+        }
+    }
+}
+
+static void
+CompleteBatch(SDL_AsyncIOTask **batch, int count)
+{
+    SDL_AsyncIOQueue *queues[ASYNCIO_MAX_BATCH];
+    SDL_AsyncIOID ids[ASYNCIO_MAX_BATCH];
+    void *userdata[ASYNCIO_MAX_BATCH];
+    int i;
+
+    SDL_LockMutex(pool.lock);
+    for (i = 0; i < count; i++) {
+        SDL_AsyncIOTask *task = batch[i];
+        SDL_AsyncIOTask **link = &pool.running;
+
+        while (*link != task) {
+            link = &(*link)->next;
+        }
+        *link = task->next;
+
+        /* Once it's on the completed list, the app may free it. */
+        queues[i] = task->queue;
+        ids[i] = task->id;
+        userdata[i] = task->userdata;
+        AppendCompleted(task);
+        queues[i]->outstanding--;
+        queues[i]->busy++;
+        SDL_CondBroadcast(queues[i]->done);
+    }
+    SDL_UnlockMutex(pool.lock);
+
+    /* Events go out without the lock held, in case an event watcher
+       calls back in. */
+    for (i = 0; i < count; i++) {
+        if (queues[i]->event_type) {
+            PostCompletionEvent(queues[i]->event_type, queues[i], ids[i], userdata[i]);
+        }
+    }
+
+    /* Only now may SDL_DestroyAsyncIOQueue() free the queue. */
+    SDL_LockMutex(pool.lock);
+    for (i = 0; i < count; i++) {
+        queues[i]->busy--;
+        SDL_CondBroadcast(queues[i]->done);
+    }
+    SDL_UnlockMutex(pool.lock);
+}
+
+static int SDLCALL
+SDL_AsyncIOThread(void *data)
+{
+    SDL_AsyncIOTask *batch[ASYNCIO_MAX_BATCH];
+
+    SDL_LockMutex(pool.lock);
+    for (;;) {
+        const int count = TakeBatch(batch);
+        if (!count) {
+            if (pool.shutdown) {
+                break;
+            }
+            SDL_CondWait(pool.wake, pool.lock);
+            continue;
+        }
+        SDL_UnlockMutex(pool.lock);
+        RunBatch(batch, count);
+        CompleteBatch(batch, count);
+        SDL_LockMutex(pool.lock);
+    }
+    SDL_UnlockMutex(pool.lock);
+    return 0;
+}
+
+/* pool_init_mutex must be held */
+static void
+StopPool(void)
+{
+    int i;
+
+    SDL_LockMutex(pool.lock);
+    pool.shutdown = SDL_TRUE;
+    SDL_CondBroadcast(pool.wake);
+    SDL_UnlockMutex(pool.lock);
+
+    for (i = 0; i < pool.num_threads; i++) {
+        SDL_WaitThread(pool.threads[i], NULL);
+        pool.threads[i] = NULL;
+    }
+    pool.num_threads = 0;
+
+    SDL_DestroyCond(pool.wake);
+    SDL_DestroyMutex(pool.lock);
+    pool.wake = NULL;
+    pool.lock = NULL;
+    pool.shutdown = SDL_FALSE;
+}
+
+/* pool_init_mutex must be held */
+static int
+StartPool(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_THREADS);
+    int num_threads = ASYNCIO_DEFAULT_THREADS;
+    int i;
+
+    if (hint && *hint) {
+        num_threads = SDL_atoi(hint);
+        if (num_threads < 1) {
+            num_threads = 1;
+        } else if (num_threads > ASYNCIO_MAX_THREADS) {
+            num_threads = ASYNCIO_MAX_THREADS;
+        }
+    }
+
+    pool.lock = SDL_CreateMutex();
+    pool.wake = SDL_CreateCond();
+    if (!pool.lock || !pool.wake) {
+        SDL_DestroyCond(pool.wake);
+        SDL_DestroyMutex(pool.lock);
+        pool.wake = NULL;
+        pool.lock = NULL;
+        return -1;
+    }
+
+    for (i = 0; i < num_threads; i++) {
+        SDL_Thread *thread = SDL_CreateThreadInternal(SDL_AsyncIOThread, "SDLAsyncIO", 0, NULL);
+        if (!thread) {
+            break;
+        }
+        pool.threads[pool.num_threads++] = thread;
+    }
+    if (pool.num_threads == 0) {
+        StopPool();
+        return -1;
+    }
+    return 0;
+}
+
+SDL_AsyncIOQueue *
+SDL_CreateAsyncIOQueue(Uint32 event_type)
+{
+    SDL_AsyncIOQueue *queue;
+
+    queue = (SDL_AsyncIOQueue *) SDL_calloc(1, sizeof (*queue));
+    if (!queue) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    queue->event_type = event_type;
+    queue->done = SDL_CreateCond();
+    if (!queue->done) {
+        SDL_free(queue);
+        return NULL;
+    }
+
+    if (LockPoolInit() < 0) {
+        SDL_DestroyCond(queue->done);
+        SDL_free(queue);
+        return NULL;
+    }
+    if ((pool.num_queues == 0) && (StartPool() < 0)) {
+        SDL_UnlockMutex(pool_init_mutex);
+        SDL_DestroyCond(queue->done);
+        SDL_free(queue);
+        return NULL;
+    }
+    pool.num_queues++;
+    SDL_UnlockMutex(pool_init_mutex);
+
+    return queue;
+}
+
+void
+SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
+{
+    SDL_AsyncIOTask *task, *next;
+    int priority;
+
+    if (!queue) {
+        return;
+    }
+
+    SDL_LockMutex(pool.lock);
+
+    /* Drop everything that hasn't started yet... */
+    for (priority = 0; priority < ASYNCIO_NUM_PRIORITIES; priority++) {
+        SDL_AsyncIOTask **link = &pool.pending[priority];
+        pool.pending_tail[priority] = NULL;
+        while (*link) {
+            task = *link;
+            if (task->queue == queue) {
+                *link = task->next;
+                queue->outstanding--;
+                FreeTask(task, SDL_TRUE);
+            } else {
+                pool.pending_tail[priority] = task;
+                link = &task->next;
+            }
+        }
+    }
+
+    /* ...stop what has, and wait for it to finish. */
+    for (task = pool.running; task; task = task->next) {
+        if (task->queue == queue) {
+            SDL_AtomicSet(&task->cancelled, 1);
+        }
+    }
+    while ((queue->outstanding > 0) || (queue->busy > 0)) {
+        SDL_CondWait(queue->done, pool.lock);
+    }
+
+    for (task = queue->completed; task; task = next) {
+        next = task->next;
+        FreeTask(task, SDL_TRUE);
+    }
+    SDL_UnlockMutex(pool.lock);
+
+    SDL_DestroyCond(queue->done);
+    SDL_free(queue);
+
+    /* The queue existed, so the mutex does too */
+    SDL_LockMutex(pool_init_mutex);
+    if (--pool.num_queues == 0) {
+        StopPool();
+    }
+    SDL_UnlockMutex(pool_init_mutex);
+}
+
+int
+SDL_AsyncReadBatch(SDL_AsyncIOQueue *queue, const SDL_AsyncReadRequest *requests,
+                   int count, SDL_AsyncIOID *ids)
+{
+    SDL_AsyncIOTask *tasks = NULL, *task;
+    int i;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    if (!requests || (count < 0)) {
+        return SDL_InvalidParamError("requests");
+    }
+
+    /* Build every task before queueing any, so a batch goes in whole or
+       not at all. */
+    for (i = count - 1; i >= 0; i--) {
+        const SDL_AsyncReadRequest *request = &requests[i];
+
+        if (!request->file || !*request->file || (request->offset < 0) ||
+            (request->buffer && !request->length) ||
+            (request->priority < SDL_ASYNCIO_PRIORITY_LOW) ||
+            (request->priority > SDL_ASYNCIO_PRIORITY_HIGH)) {
+            SDL_InvalidParamError("requests");
+            goto failed;
+        }
+
+        task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+        if (!task) {
+            SDL_OutOfMemory();
+            goto failed;
+        }
+        task->file = SDL_strdup(request->file);
+        if (!task->file) {
+            SDL_free(task);
+            SDL_OutOfMemory();
+            goto failed;
+        }
+        task->queue = queue;
+        task->offset = request->offset;
+        task->length = request->length;
+        task->buffer = request->buffer;
+        task->priority = (int) request->priority;
+        task->userdata = request->userdata;
+        task->result = SDL_ASYNCIO_FAILURE;
+        task->next = tasks;
+        tasks = task;
+    }
+
+    SDL_LockMutex(pool.lock);
+    for (i = 0; i < count; i++) {
+        task = tasks;
+        tasks = task->next;
+
+        if (++pool.next_id == 0) {
+            pool.next_id = 1;
+        }
+        task->id = pool.next_id;
+        if (ids) {
+            ids[i] = task->id;
+        }
+
+        task->next = NULL;
+        if (pool.pending_tail[task->priority]) {
+            pool.pending_tail[task->priority]->next = task;
+        } else {
+            pool.pending[task->priority] = task;
+        }
+        pool.pending_tail[task->priority] = task;
+    }
+    queue->outstanding += count;
+    if (count == 1) {
+        SDL_CondSignal(pool.wake);
+    } else if (count > 1) {
+        SDL_CondBroadcast(pool.wake);
+    }
+    SDL_UnlockMutex(pool.lock);
+    return 0;
+
+failed:
+    while (tasks) {
+        task = tasks;
+        tasks = task->next;
+        FreeTask(task, SDL_FALSE);
+    }
+    return -1;
+}
+
+SDL_AsyncIOID
+SDL_AsyncRead(SDL_AsyncIOQueue *queue, const SDL_AsyncReadRequest *request)
+{
+    SDL_AsyncIOID id = 0;
+
+    if (!request) {
+        SDL_InvalidParamError("request");
+        return 0;
+    }
+    if (SDL_AsyncReadBatch(queue, request, 1, &id) < 0) {
+        return 0;
+    }
+    return id;
+}
+
+int
+SDL_CancelAsyncIO(SDL_AsyncIOQueue *queue, SDL_AsyncIOID id)
+{
+    SDL_AsyncIOTask *task;
+    int priority;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_LockMutex(pool.lock);
+
+    /* A request that is still pending completes right away... */
+    for (priority = 0; priority < ASYNCIO_NUM_PRIORITIES; priority++) {
+        SDL_AsyncIOTask **link = &pool.pending[priority];
+        SDL_AsyncIOTask *prev = NULL;
+        while (*link) {
+            task = *link;
+            if ((task->id == id) && (task->queue == queue)) {
+                void *userdata = task->userdata;
+                *link = task->next;
+                if (pool.pending_tail[priority] == task) {
+                    pool.pending_tail[priority] = prev;
+                }
+                task->result = SDL_ASYNCIO_CANCELLED;
+                AppendCompleted(task);
+                queue->outstanding--;
+                SDL_CondBroadcast(queue->done);
+                SDL_UnlockMutex(pool.lock);
+                if (queue->event_type) {
+                    PostCompletionEvent(queue->event_type, queue, id, userdata);
+                }
+                return 0;
+            }
+            prev = task;
+            link = &task->next;
+        }
+    }
+
+    /* ...one that is running stops at the next chunk. */
+    for (task = pool.running; task; task = task->next) {
+        if ((task->id == id) && (task->queue == queue)) {
+            SDL_AtomicSet(&task->cancelled, 1);
+            SDL_UnlockMutex(pool.lock);
+            return 0;
+        }
+    }
+
+    SDL_UnlockMutex(pool.lock);
+    return SDL_SetError("No pending request with that ID");
+}
+
+static void
+TakeCompleted(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_AsyncIOTask *task = queue->completed;
+
+    queue->completed = task->next;
+    if (!queue->completed) {
+        queue->completed_tail = NULL;
+    }
+
+    outcome->id = task->id;
+    outcome->result = task->result;
+    outcome->buffer = task->buffer;
+    outcome->offset = task->offset;
+    outcome->requested = task->length;
+    outcome->transferred = task->transferred;
+    outcome->userdata = task->userdata;
+    FreeTask(task, SDL_FALSE);
+}
+
+SDL_bool
+SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_bool retval = SDL_FALSE;
+
+    if (!queue || !outcome) {
+        return SDL_FALSE;
+    }
+
+    SDL_LockMutex(pool.lock);
+    if (queue->completed) {
+        TakeCompleted(queue, outcome);
+        retval = SDL_TRUE;
+    }
+    SDL_UnlockMutex(pool.lock);
+    return retval;
+}
+
+SDL_bool
+SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeout)
+{
+    const Uint32 start = SDL_GetTicks();
+    SDL_bool retval = SDL_FALSE;
+
+    if (!queue || !outcome) {
+        return SDL_FALSE;
+    }
+
+    SDL_LockMutex(pool.lock);
+    for (;;) {
+        if (queue->completed) {
+            TakeCompleted(queue, outcome);
+            retval = SDL_TRUE;
+            break;
+        }
+        if (queue->outstanding == 0) {
+            break;  /* nothing left that could complete */
+        }
+        if (timeout < 0) {
+            SDL_CondWait(queue->done, pool.lock);
+        } else {
+            const Uint32 elapsed = SDL_GetTicks() - start;
+            if (elapsed >= (Uint32) timeout) {
+                break;
+            }
+            SDL_CondWaitTimeout(queue->done, pool.lock, (Uint32) timeout - elapsed);
+        }
+    }
+    SDL_UnlockMutex(pool.lock);
+    return retval;
+}
+
+int
+SDL_GetAsyncIOOutstanding(SDL_AsyncIOQueue *queue)
+{
+    int retval;
+
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_LockMutex(pool.lock);
+    retval = queue->outstanding;
+    SDL_UnlockMutex(pool.lock);
+    return retval;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -42,6 +42,17 @@
 #include <limits.h>
 #endif
 
+#if defined(__WIN32__)
+#define HAVE_MAPPED_FILES 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define HAVE_MAPPED_FILES 1
+#endif
+
 /* This file provides a general interface for SDL to read and write
    data sources.  It can easily be extended to files, memory, etc.
 */
@@ -523,6 +534,160 @@ mem_close(SDL_RWops * context)
 }
 
 
+/* Functions to read memory-mapped files */
+
+#ifdef HAVE_MAPPED_FILES
+
+/* Empty files can't be mapped, so they all share this instead */
+static Uint8 mapped_empty[1];
+
+#ifdef __WIN32__
+static Uint8 *
+map_file(const char *file, size_t *datasize)
+{
+    UINT old_error_mode;
+    HANDLE h, mapping;
+    LARGE_INTEGER size;
+    void *data;
+
+    /* Do not open a dialog box if failure */
+    old_error_mode =
+        SetErrorMode(SEM_NOOPENFILEERRORBOX | SEM_FAILCRITICALERRORS);
+
+    {
+        LPTSTR tstr = WIN_UTF8ToString(file);
+        h = CreateFile(tstr, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        SDL_free(tstr);
+    }
+
+    /* restore old behavior */
+    SetErrorMode(old_error_mode);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        SDL_SetError("Couldn't open %s", file);
+        return NULL;
+    }
+    if (!GetFileSizeEx(h, &size)) {
+        CloseHandle(h);
+        WIN_SetError("GetFileSizeEx()");
+        return NULL;
+    }
+    if ((Uint64) size.QuadPart > (Uint64) ((size_t) -1)) {
+        CloseHandle(h);
+        SDL_SetError("%s is too large to map", file);
+        return NULL;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(h);
+        *datasize = 0;
+        return mapped_empty;
+    }
+
+    /* The view keeps the mapping and the file open until it's unmapped. */
+    mapping = CreateFileMapping(h, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(h);
+    if (!mapping) {
+        WIN_SetError("CreateFileMapping()");
+        return NULL;
+    }
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) {
+        WIN_SetError("MapViewOfFile()");
+        return NULL;
+    }
+
+    *datasize = (size_t) size.QuadPart;
+    return (Uint8 *) data;
+}
+
+static void
+unmap_file(Uint8 *data, size_t datasize)
+{
+    if (datasize > 0) {
+        UnmapViewOfFile(data);
+    }
+}
+#else
+static Uint8 *
+map_file(const char *file, size_t *datasize)
+{
+    struct stat st;
+    void *data;
+    int fd;
+
+#ifdef O_CLOEXEC
+    fd = open(file, O_RDONLY | O_CLOEXEC);
+#else
+    fd = open(file, O_RDONLY);
+#endif
+    if (fd < 0) {
+        SDL_SetError("Couldn't open %s", file);
+        return NULL;
+    }
+    if ((fstat(fd, &st) < 0) || !S_ISREG(st.st_mode)) {
+        close(fd);
+        SDL_SetError("Couldn't map %s: not a regular file", file);
+        return NULL;
+    }
+    if ((Uint64) st.st_size > (Uint64) ((size_t) -1)) {
+        close(fd);
+        SDL_SetError("%s is too large to map", file);
+        return NULL;
+    }
+    if (st.st_size == 0) {
+        close(fd);
+        *datasize = 0;
+        return mapped_empty;
+    }
+
+    /* The mapping keeps the file open until it's unmapped. */
+    data = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        SDL_SetError("Couldn't map %s", file);
+        return NULL;
+    }
+
+    *datasize = (size_t) st.st_size;
+    return (Uint8 *) data;
+}
+
+static void
+unmap_file(Uint8 *data, size_t datasize)
+{
+    if (datasize > 0) {
+        munmap(data, datasize);
+    }
+}
+#endif /* __WIN32__ */
+
+static int SDLCALL
+mapped_close(SDL_RWops * context)
+{
+    if (context) {
+        unmap_file(context->hidden.mem.base,
+                   (size_t) (context->hidden.mem.stop - context->hidden.mem.base));
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+
+#endif /* HAVE_MAPPED_FILES */
+
+/* Used when a file can't be mapped and was read into memory instead */
+static int SDLCALL
+mem_close_free(SDL_RWops * context)
+{
+    if (context) {
+        SDL_free(context->hidden.mem.base);
+        SDL_FreeRW(context);
+    }
+    return 0;
+}
+
+
 /* Functions to create SDL_RWops structures from various data sources */
 
 SDL_RWops *
@@ -697,6 +862,110 @@ SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *
+SDL_RWFromMappedFile(const char *file)
+{
+    SDL_RWops *rwops = NULL;
+    Uint8 *data = NULL;
+    size_t datasize = 0;
+    SDL_bool mapped = SDL_FALSE;
+
+    if (!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+#ifdef HAVE_MAPPED_FILES
+#if defined(__ANDROID__)
+    /* Same search order as SDL_RWFromFile(), minus the asset system */
+    if (*file == '/') {
+        data = map_file(file, &datasize);
+    } else {
+        char *path = SDL_stack_alloc(char, PATH_MAX);
+        if (path) {
+            SDL_snprintf(path, PATH_MAX, "%s/%s",
+                         SDL_AndroidGetInternalStoragePath(), file);
+            data = map_file(path, &datasize);
+            SDL_stack_free(path);
+        }
+    }
+#elif defined(__APPLE__)
+    /* Relative paths may refer to the app bundle; leave those to SDL_RWFromFile() */
+    if (*file == '/') {
+        data = map_file(file, &datasize);
+    }
+#else
+    data = map_file(file, &datasize);
+#endif
+    mapped = (data != NULL) ? SDL_TRUE : SDL_FALSE;
+#endif /* HAVE_MAPPED_FILES */
+
+    if (!mapped) {
+        /* Android assets, pipes, platforms without mapping: read it all in.
+           The result behaves the same, it just isn't shared with the page cache. */
+        SDL_RWops *src = SDL_RWFromFile(file, "rb");
+        if (!src) {
+            return NULL;
+        }
+        data = (Uint8 *) SDL_LoadFile_RW(src, &datasize, 1);
+        if (!data) {
+            return NULL;
+        }
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+#ifdef HAVE_MAPPED_FILES
+        if (mapped) {
+            unmap_file(data, datasize);
+        } else
+#endif
+        {
+            SDL_free(data);
+        }
+        return NULL;
+    }
+
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+#ifdef HAVE_MAPPED_FILES
+    rwops->close = mapped ? mapped_close : mem_close_free;
+#else
+    rwops->close = mem_close_free;
+#endif
+    rwops->hidden.mem.base = data;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + datasize;
+    rwops->type = mapped ? SDL_RWOPS_MAPPED : SDL_RWOPS_MEMORY_RO;
+    return rwops;
+}
+
+const void *
+SDL_RWGetMemory(SDL_RWops * context, size_t *size)
+{
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPPED:
+        if (size) {
+            *size = (size_t) (context->hidden.mem.stop - context->hidden.mem.base);
+        }
+        return context->hidden.mem.base;
+    default:
+        break;
+    }
+
+    SDL_SetError("SDL_RWops is not backed by memory");
+    return NULL;
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -736,11 +1005,23 @@ SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize, int freesrc)
         size = FILE_CHUNK_SIZE;
     }
     data = SDL_malloc((size_t)(size + 1));
+    if (!data) {
+        SDL_OutOfMemory();
+        goto done;
+    }
 
     size_total = 0;
     for (;;) {
-        if ((((Sint64)size_total) + FILE_CHUNK_SIZE) > size) {
-            size = (size_total + FILE_CHUNK_SIZE);
+        if (((Sint64)size_total) >= size) {
+            /* The buffer is full. Make sure there's more to come before
+               growing it, so a stream of known size is read without a
+               realloc, and grow geometrically so one of unknown size
+               isn't copied over and over. */
+            Uint8 next;
+            if (SDL_RWread(src, &next, 1, 1) == 0) {
+                break;
+            }
+            size = size_total + SDL_max(size_total, (size_t)FILE_CHUNK_SIZE);
             newdata = SDL_realloc(data, (size_t)(size + 1));
             if (!newdata) {
                 SDL_free(data);
@@ -749,6 +1030,7 @@ SDL_LoadFile_RW(SDL_RWops * src, size_t *datasize, int freesrc)
                 goto done;
             }
             data = newdata;
+            ((Uint8 *)data)[size_total++] = next;
         }
 
         size_read = SDL_RWread(src, (char *)data+size_total, 1, (size_t)(size-size_total));
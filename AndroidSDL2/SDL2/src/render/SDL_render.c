@@ -191,6 +191,15 @@ DebugLogRenderCommands(const SDL_RenderCommand *cmd)
                 break;
 
 
+            case SDL_RENDERCMD_COPY_BATCH:
+                SDL_Log(" %u. copybatch (first=%u, count=%u, r=%d, g=%d, b=%d, a=%d, blend=%d, tex=%p)", i++,
+                        (unsigned int) cmd->data.draw.first,
+                        (unsigned int) cmd->data.draw.count,
+                        (int) cmd->data.draw.r, (int) cmd->data.draw.g,
+                        (int) cmd->data.draw.b, (int) cmd->data.draw.a,
+                        (int) cmd->data.draw.blend, cmd->data.draw.texture);
+                break;
+
             case SDL_RENDERCMD_COPY_EX:
                 SDL_Log(" %u. copyex (first=%u, count=%u, r=%d, g=%d, b=%d, a=%d, blend=%d, tex=%p)", i++,
                         (unsigned int) cmd->data.draw.first,
@@ -205,11 +214,43 @@ DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+/* Exchanges the renderer's command queue with the one held by a render list */
+static void
+SwapRenderList(SDL_Renderer *renderer, SDL_RenderList *list)
+{
+#define SWAP_FIELD(type, field) { type tmp = renderer->field; renderer->field = list->field; list->field = tmp; }
+    SWAP_FIELD(SDL_bool, batching);
+    SWAP_FIELD(SDL_RenderCommand *, render_commands);
+    SWAP_FIELD(SDL_RenderCommand *, render_commands_tail);
+    SWAP_FIELD(Uint32, last_queued_color);
+    SWAP_FIELD(SDL_Rect, last_queued_viewport);
+    SWAP_FIELD(SDL_Rect, last_queued_cliprect);
+    SWAP_FIELD(SDL_bool, last_queued_cliprect_enabled);
+    SWAP_FIELD(SDL_bool, color_queued);
+    SWAP_FIELD(SDL_bool, viewport_queued);
+    SWAP_FIELD(SDL_bool, cliprect_queued);
+    SWAP_FIELD(void *, vertex_data);
+    SWAP_FIELD(size_t, vertex_data_used);
+    SWAP_FIELD(size_t, vertex_data_allocation);
+#undef SWAP_FIELD
+}
+
 static int
 FlushRenderCommands(SDL_Renderer *renderer)
 {
+    SDL_RenderList *recording = renderer->recording_list;
     int retval;
 
+    if (recording != NULL) {
+        /* Run the renderer's own queue, leaving the list being recorded alone. */
+        renderer->recording_list = NULL;
+        SwapRenderList(renderer, recording);
+        retval = FlushRenderCommands(renderer);
+        SwapRenderList(renderer, recording);
+        renderer->recording_list = recording;
+        return retval;
+    }
+
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
 
     if (renderer->render_commands == NULL) {  /* nothing to do! */
@@ -546,6 +587,77 @@ QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture * texture,
     return retval;
 }
 
+static int
+QueueCmdCopyBatch(SDL_Renderer *renderer, SDL_Texture * texture,
+                  const SDL_RenderCopyItem * items, const int count)
+{
+    SDL_RenderCommand *cmd = PrepQueueCmdDrawTexture(renderer, texture, SDL_RENDERCMD_COPY_BATCH);
+    int retval = -1;
+    SDL_assert(renderer->QueueCopyBatch != NULL);  /* should have caught at higher level. */
+    if (cmd != NULL) {
+        retval = renderer->QueueCopyBatch(renderer, cmd, texture, items, count);
+        if (retval < 0) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        }
+    }
+    return retval;
+}
+
+void
+SDL_GetRenderCopyCorners(const SDL_RenderCopyItem *item, SDL_FPoint corners[4])
+{
+    const SDL_FRect *dstrect = &item->dstrect;
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (item->angle == 0.0) {
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
+    } else {
+        minx = -dstrect->w / 2.0f;
+        miny = -dstrect->h / 2.0f;
+        maxx = dstrect->w / 2.0f;
+        maxy = dstrect->h / 2.0f;
+    }
+
+    if (item->flip & SDL_FLIP_HORIZONTAL) {
+        const float tmp = minx;
+        minx = maxx;
+        maxx = tmp;
+    }
+    if (item->flip & SDL_FLIP_VERTICAL) {
+        const float tmp = miny;
+        miny = maxy;
+        maxy = tmp;
+    }
+
+    corners[0].x = minx;
+    corners[0].y = miny;
+    corners[1].x = maxx;
+    corners[1].y = miny;
+    corners[2].x = minx;
+    corners[2].y = maxy;
+    corners[3].x = maxx;
+    corners[3].y = maxy;
+
+    if (item->angle != 0.0) {
+        /* Rotate around the center of the destination rect, clockwise on screen */
+        const double radians = item->angle * M_PI / 180.0;
+        const float s = (float) SDL_sin(radians);
+        const float c = (float) SDL_cos(radians);
+        const float centerx = dstrect->x + dstrect->w / 2.0f;
+        const float centery = dstrect->y + dstrect->h / 2.0f;
+
+        for (i = 0; i < 4; ++i) {
+            const float x = corners[i].x;
+            const float y = corners[i].y;
+            corners[i].x = centerx + x * c - y * s;
+            corners[i].y = centery + x * s + y * c;
+        }
+    }
+}
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
@@ -3104,6 +3216,315 @@ SDL_RenderCopyExF(SDL_Renderer * renderer, SDL_Texture * texture,
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
 
+int
+SDL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_RenderCopyItem * items, int count)
+{
+    SDL_RenderCopyItem *real_items;
+    SDL_Rect r;
+    SDL_FRect viewport;
+    int i, real_count = 0;
+    int retval = 0;
+    SDL_bool isstack;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!items) {
+        return SDL_SetError("SDL_RenderCopyBatch(): Passed NULL items");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    real_items = SDL_small_alloc(SDL_RenderCopyItem, count, &isstack);
+    if (!real_items) {
+        return SDL_OutOfMemory();
+    }
+
+    SDL_zero(r);
+    SDL_RenderGetViewport(renderer, &r);
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.w = (float) r.w;
+    viewport.h = (float) r.h;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_RenderCopyItem *item = &items[i];
+        SDL_RenderCopyItem *real_item = &real_items[real_count];
+        SDL_FRect bounds;
+
+        real_item->srcrect.x = 0;
+        real_item->srcrect.y = 0;
+        real_item->srcrect.w = texture->w;
+        real_item->srcrect.h = texture->h;
+        if (!SDL_RectEmpty(&item->srcrect)) {
+            if (!SDL_IntersectRect(&item->srcrect, &real_item->srcrect, &real_item->srcrect)) {
+                continue;
+            }
+        }
+
+        real_item->angle = item->angle;
+        if ((int)(item->angle/360) == item->angle/360) {
+            real_item->angle = 0.0;
+        }
+        real_item->flip = item->flip;
+
+        /* Rotated copies are culled by a square that holds them at any angle */
+        bounds = item->dstrect;
+        if (real_item->angle != 0.0) {
+            const float radius = (float) ((SDL_fabs(bounds.w) + SDL_fabs(bounds.h)) / 2.0);
+            bounds.x += (bounds.w / 2.0f) - radius;
+            bounds.y += (bounds.h / 2.0f) - radius;
+            bounds.w = radius * 2.0f;
+            bounds.h = radius * 2.0f;
+        }
+        if (!SDL_HasIntersectionF(&bounds, &viewport)) {
+            continue;
+        }
+
+        real_item->dstrect.x = item->dstrect.x * renderer->scale.x;
+        real_item->dstrect.y = item->dstrect.y * renderer->scale.y;
+        real_item->dstrect.w = item->dstrect.w * renderer->scale.x;
+        real_item->dstrect.h = item->dstrect.h * renderer->scale.y;
+        ++real_count;
+    }
+
+    if (real_count > 0) {
+        if (texture->native) {
+            texture = texture->native;
+        }
+
+        texture->last_command_generation = renderer->render_command_generation;
+
+        if (renderer->QueueCopyBatch) {
+            retval = QueueCmdCopyBatch(renderer, texture, real_items, real_count);
+        } else {
+            /* Queue the copies one at a time, the same way SDL_RenderCopyExF() would */
+            for (i = 0; retval == 0 && i < real_count; ++i) {
+                const SDL_RenderCopyItem *item = &real_items[i];
+                if (item->angle == 0.0 && item->flip == SDL_FLIP_NONE) {
+                    retval = QueueCmdCopy(renderer, texture, &item->srcrect, &item->dstrect);
+                } else if (renderer->QueueCopyEx) {
+                    SDL_FPoint center;
+                    center.x = item->dstrect.w / 2.0f;
+                    center.y = item->dstrect.h / 2.0f;
+                    retval = QueueCmdCopyEx(renderer, texture, &item->srcrect, &item->dstrect,
+                                            item->angle, &center, item->flip);
+                } else {
+                    retval = SDL_SetError("Renderer does not support RenderCopyEx");
+                }
+            }
+        }
+    }
+
+    SDL_small_free(real_items, isstack);
+
+    return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
+}
+
+int
+SDL_RenderBeginList(SDL_Renderer * renderer)
+{
+    SDL_RenderList *list;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (renderer->recording_list) {
+        return SDL_SetError("Already recording a render list");
+    }
+
+    list = (SDL_RenderList *) SDL_calloc(1, sizeof (*list));
+    if (!list) {
+        return SDL_OutOfMemory();
+    }
+    list->renderer = renderer;
+
+    /* Record into an empty queue that queues its own state before the first
+       draw and is never flushed, so it can be replayed on its own later. */
+    list->batching = SDL_TRUE;
+    SwapRenderList(renderer, list);
+    renderer->recording_list = list;
+
+    list->next = renderer->render_lists;
+    if (renderer->render_lists) {
+        renderer->render_lists->prev = list;
+    }
+    renderer->render_lists = list;
+
+    return 0;
+}
+
+SDL_RenderList *
+SDL_RenderEndList(SDL_Renderer * renderer)
+{
+    SDL_RenderList *list;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    list = renderer->recording_list;
+    if (!list) {
+        SDL_SetError("Not recording a render list");
+        return NULL;
+    }
+
+    SwapRenderList(renderer, list);
+    renderer->recording_list = NULL;
+
+    return list;
+}
+
+/* Vertex data is replayed at this alignment, so the offsets the backend
+   aligned while recording (starting from zero) stay aligned. */
+#define RENDER_LIST_VERTEX_ALIGN    256
+
+int
+SDL_RenderReplayList(SDL_Renderer * renderer, SDL_RenderList * list, int x, int y)
+{
+    const SDL_RenderCommand *src;
+    size_t base = 0;
+    int dx, dy;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!list) {
+        return SDL_InvalidParamError("list");
+    }
+    if (list->renderer != renderer) {
+        return SDL_SetError("Render list was recorded with a different renderer");
+    }
+    if (list == renderer->recording_list) {
+        return SDL_SetError("Can't replay a render list while recording it");
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (list->vertex_data_used > 0) {
+        void *vertices = SDL_AllocateRenderVertices(renderer, list->vertex_data_used, RENDER_LIST_VERTEX_ALIGN, &base);
+        if (!vertices) {
+            return -1;
+        }
+        SDL_memcpy(vertices, list->vertex_data, list->vertex_data_used);
+    }
+
+    dx = (int)SDL_floor(x * renderer->scale.x);
+    dy = (int)SDL_floor(y * renderer->scale.y);
+
+    for (src = list->render_commands; src != NULL; src = src->next) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (cmd == NULL) {
+            return -1;
+        }
+
+        cmd->command = src->command;
+        SDL_memcpy(&cmd->data, &src->data, sizeof (cmd->data));
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                cmd->data.viewport.first += base;
+                cmd->data.viewport.rect.x += dx;
+                cmd->data.viewport.rect.y += dy;
+                break;
+
+            case SDL_RENDERCMD_SETDRAWCOLOR:
+            case SDL_RENDERCMD_CLEAR:
+                cmd->data.color.first += base;
+                break;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+                cmd->data.draw.first += base;
+                break;
+
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+            case SDL_RENDERCMD_COPY_BATCH:
+                cmd->data.draw.first += base;
+                cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* The list left the backend in its own state, queue ours again before the next draw */
+    renderer->color_queued = SDL_FALSE;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
+static void
+FreeRenderCommands(SDL_RenderCommand *cmd)
+{
+    while (cmd != NULL) {
+        SDL_RenderCommand *next = cmd->next;
+        SDL_free(cmd);
+        cmd = next;
+    }
+}
+
+void
+SDL_DestroyRenderList(SDL_RenderList * list)
+{
+    SDL_Renderer *renderer;
+
+    if (!list) {
+        return;
+    }
+
+    renderer = list->renderer;
+    if (renderer) {
+        if (list == renderer->recording_list) {
+            SDL_RenderEndList(renderer);
+        }
+        if (list->next) {
+            list->next->prev = list->prev;
+        }
+        if (list->prev) {
+            list->prev->next = list->next;
+        } else {
+            renderer->render_lists = list->next;
+        }
+    }
+
+    FreeRenderCommands(list->render_commands);
+    SDL_free(list->vertex_data);
+    SDL_free(list);
+}
+
+/* Drops the recorded copies of a texture that is being destroyed */
+static void
+RemoveTextureFromRenderLists(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    SDL_RenderList *list;
+
+    for (list = renderer->render_lists; list != NULL; list = list->next) {
+        SDL_RenderCommand *cmd = (list == renderer->recording_list) ? renderer->render_commands : list->render_commands;
+        for ( ; cmd != NULL; cmd = cmd->next) {
+            if ((cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX ||
+                 cmd->command == SDL_RENDERCMD_COPY_BATCH) && cmd->data.draw.texture == texture) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+            }
+        }
+    }
+}
+
 int
 SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                      Uint32 format, void * pixels, int pitch)
@@ -3171,6 +3592,8 @@ SDL_DestroyTexture(SDL_Texture * texture)
         FlushRenderCommandsIfTextureNeeded(texture);
     }
 
+    RemoveTextureFromRenderLists(texture);
+
     texture->magic = NULL;
 
     if (texture->next) {
@@ -3209,6 +3632,17 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    /* The render lists stay valid until the app destroys them, but can't be replayed */
+    if (renderer->recording_list) {
+        SDL_RenderEndList(renderer);
+    }
+    while (renderer->render_lists) {
+        SDL_RenderList *list = renderer->render_lists;
+        renderer->render_lists = list->next;
+        list->renderer = NULL;
+        list->prev = list->next = NULL;
+    }
+
     if (renderer->render_commands_tail != NULL) {
         renderer->render_commands_tail->next = renderer->render_commands_pool;
         cmd = renderer->render_commands;
@@ -74,7 +74,8 @@ typedef enum
     SDL_RENDERCMD_DRAW_LINES,
     SDL_RENDERCMD_FILL_RECTS,
     SDL_RENDERCMD_COPY,
-    SDL_RENDERCMD_COPY_EX
+    SDL_RENDERCMD_COPY_EX,
+    SDL_RENDERCMD_COPY_BATCH
 } SDL_RenderCommandType;
 
 typedef struct SDL_RenderCommand
@@ -127,6 +128,8 @@ struct SDL_Renderer
     int (*QueueCopyEx) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                         const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                         const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+    int (*QueueCopyBatch) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                           const SDL_RenderCopyItem * items, int count);
     int (*RunCommandQueue) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize);
     int (*UpdateTexture) (SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * rect, const void *pixels,
@@ -215,9 +218,38 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    /* The render lists created by this renderer, and the one being recorded */
+    SDL_RenderList *render_lists;
+    SDL_RenderList *recording_list;
+
     void *driverdata;
 };
 
+/* Define the SDL render list structure */
+struct SDL_RenderList
+{
+    SDL_Renderer *renderer;     /**< NULL once the renderer is destroyed */
+    SDL_RenderList *prev;
+    SDL_RenderList *next;
+
+    /* The recorded queue. While recording, the renderer's fields are swapped
+       with these, so they hold the renderer's own queue until recording ends. */
+    SDL_bool batching;
+    SDL_RenderCommand *render_commands;
+    SDL_RenderCommand *render_commands_tail;
+    Uint32 last_queued_color;
+    SDL_Rect last_queued_viewport;
+    SDL_Rect last_queued_cliprect;
+    SDL_bool last_queued_cliprect_enabled;
+    SDL_bool color_queued;
+    SDL_bool viewport_queued;
+    SDL_bool cliprect_queued;
+
+    void *vertex_data;
+    size_t vertex_data_used;
+    size_t vertex_data_allocation;
+};
+
 /* Define the SDL render driver structure */
 struct SDL_RenderDriver
 {
@@ -251,6 +283,11 @@ extern SDL_BlendOperation SDL_GetBlendModeAlphaOperation(SDL_BlendMode blendMode
    the next call, because it might be in an array that gets realloc()'d. */
 extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const size_t alignment, size_t *offset);
 
+/* drivers call this during QueueCopyBatch() to get the corners of a copy after it's flipped
+   and rotated, in the order of the source rect's top left, top right, bottom left and bottom
+   right corners. */
+extern void SDL_GetRenderCopyCorners(const SDL_RenderCopyItem *item, SDL_FPoint corners[4]);
+
 #endif /* SDL_sysrender_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
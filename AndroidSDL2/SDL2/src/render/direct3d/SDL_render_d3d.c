@@ -1020,6 +1020,50 @@ D3D_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * t
     return 0;
 }
 
+static int
+D3D_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                   const SDL_RenderCopyItem * items, int count)
+{
+    const DWORD color = D3DCOLOR_ARGB(cmd->data.draw.a, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b);
+    const size_t vertslen = sizeof (Vertex) * 6 * count;
+    Vertex *verts = (Vertex *) SDL_AllocateRenderVertices(renderer, vertslen, 0, &cmd->data.draw.first);
+    /* Two triangles per copy, made of these corners */
+    static const int quad[6] = { 0, 1, 2, 2, 1, 3 };
+    int i, j;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        float u[2], v[2];
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        u[0] = (float) srcrect->x / texture->w;
+        u[1] = (float) (srcrect->x + srcrect->w) / texture->w;
+        v[0] = (float) srcrect->y / texture->h;
+        v[1] = (float) (srcrect->y + srcrect->h) / texture->h;
+
+        for (j = 0; j < 6; j++) {
+            const int corner = quad[j];
+            verts->x = corners[corner].x - 0.5f;
+            verts->y = corners[corner].y - 0.5f;
+            verts->z = 0.0f;
+            verts->color = color;
+            verts->u = u[corner & 1];
+            verts->v = v[corner >> 1];
+            verts++;
+        }
+    }
+
+    return 0;
+}
+
 static int
 UpdateDirtyTexture(IDirect3DDevice9 *device, D3D_TextureRep *texture)
 {
@@ -1295,6 +1339,7 @@ D3D_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *verti
                 if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect)) != 0) {
                     SDL_memcpy(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect));
                     data->drawstate.viewport_dirty = SDL_TRUE;
+                    data->drawstate.cliprect_dirty = SDL_TRUE;  /* the scissor rect is offset by the viewport. */
                 }
                 break;
             }
@@ -1432,6 +1477,19 @@ D3D_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *verti
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                const size_t count = cmd->data.draw.count;
+                const size_t first = cmd->data.draw.first;
+                SetDrawState(data, cmd);
+                if (vbo) {
+                    IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_TRIANGLELIST, (UINT) (first / sizeof (Vertex)), (UINT) (count * 2));
+                } else {
+                    const Vertex *verts = (Vertex *) (((Uint8 *) vertices) + first);
+                    IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_TRIANGLELIST, (UINT) (count * 2), verts, sizeof (Vertex));
+                }
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1724,6 +1782,7 @@ D3D_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = D3D_QueueFillRects;
     renderer->QueueCopy = D3D_QueueCopy;
     renderer->QueueCopyEx = D3D_QueueCopyEx;
+    renderer->QueueCopyBatch = D3D_QueueCopyBatch;
     renderer->RunCommandQueue = D3D_RunCommandQueue;
     renderer->RenderReadPixels = D3D_RenderReadPixels;
     renderer->RenderPresent = D3D_RenderPresent;
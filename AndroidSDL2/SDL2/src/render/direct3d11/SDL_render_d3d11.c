@@ -699,10 +699,11 @@ D3D11_GetViewportAlignedD3DRect(SDL_Renderer * renderer, const SDL_Rect * sdlRec
             outRect->top = sdlRect->y;
             outRect->bottom = sdlRect->y + sdlRect->h;
             if (includeViewportOffset) {
-                outRect->left += renderer->viewport.x;
-                outRect->right += renderer->viewport.x;
-                outRect->top += renderer->viewport.y;
-                outRect->bottom += renderer->viewport.y;
+                const SDL_Rect *viewport = &((D3D11_RenderData *)renderer->driverdata)->currentViewport;
+                outRect->left += viewport->x;
+                outRect->right += viewport->x;
+                outRect->top += viewport->y;
+                outRect->bottom += viewport->y;
             }
             break;
         case DXGI_MODE_ROTATION_ROTATE270:
@@ -1828,6 +1829,55 @@ D3D11_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static int
+D3D11_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                     const SDL_RenderCopyItem * items, int count)
+{
+    VertexPositionColor *verts = (VertexPositionColor *) SDL_AllocateRenderVertices(renderer, count * 6 * sizeof (VertexPositionColor), 0, &cmd->data.draw.first);
+    const float r = (float)(cmd->data.draw.r / 255.0f);
+    const float g = (float)(cmd->data.draw.g / 255.0f);
+    const float b = (float)(cmd->data.draw.b / 255.0f);
+    const float a = (float)(cmd->data.draw.a / 255.0f);
+    /* Two triangles per copy, made of these corners */
+    static const int quad[6] = { 0, 1, 2, 2, 1, 3 };
+    int i, j;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        float u[2], v[2];
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        u[0] = (float) srcrect->x / texture->w;
+        u[1] = (float) (srcrect->x + srcrect->w) / texture->w;
+        v[0] = (float) srcrect->y / texture->h;
+        v[1] = (float) (srcrect->y + srcrect->h) / texture->h;
+
+        for (j = 0; j < 6; j++) {
+            const int corner = quad[j];
+            verts->pos.x = corners[corner].x;
+            verts->pos.y = corners[corner].y;
+            verts->pos.z = 0.0f;
+            verts->color.x = r;
+            verts->color.y = g;
+            verts->color.z = b;
+            verts->color.w = a;
+            verts->tex.x = u[corner & 1];
+            verts->tex.y = v[corner >> 1];
+            verts++;
+        }
+    }
+
+    return 0;
+}
+
 
 static int
 D3D11_UpdateVertexBuffer(SDL_Renderer *renderer,
@@ -2226,6 +2276,7 @@ D3D11_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect)) != 0) {
                     SDL_memcpy(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect));
                     rendererData->viewportDirty = SDL_TRUE;
+                    rendererData->cliprectDirty = SDL_TRUE;  /* the scissor rect is offset by the viewport. */
                 }
                 break;
             }
@@ -2310,6 +2361,15 @@ D3D11_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                const size_t count = cmd->data.draw.count;
+                const size_t first = cmd->data.draw.first;
+                const size_t start = first / sizeof (VertexPositionColor);
+                D3D11_SetCopyState(renderer, cmd, NULL);
+                D3D11_DrawPrimitives(renderer, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST, start, count * 6);
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -2520,6 +2580,7 @@ D3D11_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = D3D11_QueueFillRects;
     renderer->QueueCopy = D3D11_QueueCopy;
     renderer->QueueCopyEx = D3D11_QueueCopyEx;
+    renderer->QueueCopyBatch = D3D11_QueueCopyBatch;
     renderer->RunCommandQueue = D3D11_RunCommandQueue;
     renderer->RenderReadPixels = D3D11_RenderReadPixels;
     renderer->RenderPresent = D3D11_RenderPresent;
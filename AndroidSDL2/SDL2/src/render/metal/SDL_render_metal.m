@@ -1130,10 +1130,12 @@ METAL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     const float c = cosf(rads), s = sinf(rads);
     float minu, maxu, minv, maxv;
     const size_t vertlen = (sizeof (float) * 32);
+    size_t transformoffset;
     float *verts;
 
-    // cheat and store this offset in (count) because it needs to be aligned in ways other fields don't and we aren't using count otherwise.
-    verts = (float *) SDL_AllocateRenderVertices(renderer, vertlen, CONSTANT_ALIGN(16), &cmd->data.draw.count);
+    // the transform needs to be aligned in ways other fields don't. (count) is unused otherwise, so the
+    //  distance back to it from (first) is stashed there; being relative keeps the command relocatable.
+    verts = (float *) SDL_AllocateRenderVertices(renderer, vertlen, CONSTANT_ALIGN(16), &transformoffset);
     if (!verts) {
         return -1;
     }
@@ -1156,6 +1158,7 @@ METAL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     if (!verts) {
         return -1;
     }
+    cmd->data.draw.count = cmd->data.draw.first - transformoffset;
 
     minu = normtex(srcquad->x, texw);
     maxu = normtex(srcquad->x + srcquad->w, texw);
@@ -1197,6 +1200,48 @@ METAL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static int
+METAL_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                     const SDL_RenderCopyItem * items, int count)
+{
+    const float texw = (float) texture->w;
+    const float texh = (float) texture->h;
+    /* Two triangles per copy, made of these corners */
+    static const int quad[6] = { 0, 1, 2, 2, 1, 3 };
+    const size_t vertlen = (sizeof (float) * 24) * count;
+    float *verts = (float *) SDL_AllocateRenderVertices(renderer, vertlen, DEVICE_ALIGN(8), &cmd->data.draw.first);
+    int i, j;
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    /* Interleaved positions and texture coordinates */
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        float u[2], v[2];
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        u[0] = normtex(srcrect->x, texw);
+        u[1] = normtex(srcrect->x + srcrect->w, texw);
+        v[0] = normtex(srcrect->y, texh);
+        v[1] = normtex(srcrect->y + srcrect->h, texh);
+
+        for (j = 0; j < 6; j++) {
+            const int corner = quad[j];
+            *(verts++) = corners[corner].x;
+            *(verts++) = corners[corner].y;
+            *(verts++) = u[corner & 1];
+            *(verts++) = v[corner >> 1];
+        }
+    }
+
+    return 0;
+}
+
 
 typedef struct
 {
@@ -1451,11 +1496,17 @@ METAL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
 
             case SDL_RENDERCMD_COPY_EX: {
                 SetCopyState(renderer, cmd, CONSTANTS_OFFSET_INVALID, mtlbufvertex, &statecache);
-                [data.mtlcmdencoder setVertexBuffer:mtlbufvertex offset:cmd->data.draw.count atIndex:3];  // transform
+                [data.mtlcmdencoder setVertexBuffer:mtlbufvertex offset:cmd->data.draw.first - cmd->data.draw.count atIndex:3];  // transform
                 [data.mtlcmdencoder drawPrimitives:MTLPrimitiveTypeTriangleStrip vertexStart:0 vertexCount:4];
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                SetCopyState(renderer, cmd, CONSTANTS_OFFSET_IDENTITY, mtlbufvertex, &statecache);
+                [data.mtlcmdencoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:cmd->data.draw.count * 6];
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1787,6 +1838,7 @@ METAL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = METAL_QueueFillRects;
     renderer->QueueCopy = METAL_QueueCopy;
     renderer->QueueCopyEx = METAL_QueueCopyEx;
+    renderer->QueueCopyBatch = METAL_QueueCopyBatch;
     renderer->RunCommandQueue = METAL_RunCommandQueue;
     renderer->RenderReadPixels = METAL_RenderReadPixels;
     renderer->RenderPresent = METAL_RenderPresent;
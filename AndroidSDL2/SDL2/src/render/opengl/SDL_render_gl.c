@@ -988,6 +988,56 @@ GL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
     return 0;
 }
 
+static int
+GL_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                  const SDL_RenderCopyItem * items, int count)
+{
+    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 16 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        GLfloat minu, maxu, minv, maxv;
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        minu = (GLfloat) srcrect->x / texture->w;
+        minu *= texturedata->texw;
+        maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+        maxu *= texturedata->texw;
+        minv = (GLfloat) srcrect->y / texture->h;
+        minv *= texturedata->texh;
+        maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+        maxv *= texturedata->texh;
+
+        /* Texture coordinates and positions, in GL_QUADS order */
+        *(verts++) = minu;
+        *(verts++) = minv;
+        *(verts++) = corners[0].x;
+        *(verts++) = corners[0].y;
+        *(verts++) = maxu;
+        *(verts++) = minv;
+        *(verts++) = corners[1].x;
+        *(verts++) = corners[1].y;
+        *(verts++) = maxu;
+        *(verts++) = maxv;
+        *(verts++) = corners[3].x;
+        *(verts++) = corners[3].y;
+        *(verts++) = minu;
+        *(verts++) = maxv;
+        *(verts++) = corners[2].x;
+        *(verts++) = corners[2].y;
+    }
+    return 0;
+}
+
 static void
 SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, const GL_Shader shader)
 {
@@ -1171,6 +1221,7 @@ GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect)) != 0) {
                     SDL_memcpy(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect));
                     data->drawstate.viewport_dirty = SDL_TRUE;
+                    data->drawstate.cliprect_dirty = SDL_TRUE;  /* the scissor rect is offset by the viewport. */
                 }
                 break;
             }
@@ -1351,6 +1402,19 @@ GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                const size_t count = cmd->data.draw.count * 4;
+                const GLfloat *verts = (GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                SetCopyState(data, cmd);
+                data->glBegin(GL_QUADS);
+                for (i = 0; i < count; ++i, verts += 4) {
+                    data->glTexCoord2f(verts[0], verts[1]);
+                    data->glVertex2f(verts[2], verts[3]);
+                }
+                data->glEnd();
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1623,6 +1687,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = GL_QueueFillRects;
     renderer->QueueCopy = GL_QueueCopy;
     renderer->QueueCopyEx = GL_QueueCopyEx;
+    renderer->QueueCopyBatch = GL_QueueCopyBatch;
     renderer->RunCommandQueue = GL_RunCommandQueue;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
@@ -714,6 +714,69 @@ GLES_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static int
+GLES_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                    const SDL_RenderCopyItem * items, int count)
+{
+    GLES_TextureData *texturedata = (GLES_TextureData *) texture->driverdata;
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 24 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    GLfloat *texcoords;
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    /* All the positions, then all the texture coordinates, as two triangles per copy */
+    texcoords = verts + (count * 12);
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcquad = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        GLfloat minu, maxu, minv, maxv;
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        minu = (GLfloat) srcquad->x / texture->w;
+        minu *= texturedata->texw;
+        maxu = (GLfloat) (srcquad->x + srcquad->w) / texture->w;
+        maxu *= texturedata->texw;
+        minv = (GLfloat) srcquad->y / texture->h;
+        minv *= texturedata->texh;
+        maxv = (GLfloat) (srcquad->y + srcquad->h) / texture->h;
+        maxv *= texturedata->texh;
+
+        *(verts++) = corners[0].x;
+        *(verts++) = corners[0].y;
+        *(verts++) = corners[1].x;
+        *(verts++) = corners[1].y;
+        *(verts++) = corners[2].x;
+        *(verts++) = corners[2].y;
+        *(verts++) = corners[2].x;
+        *(verts++) = corners[2].y;
+        *(verts++) = corners[1].x;
+        *(verts++) = corners[1].y;
+        *(verts++) = corners[3].x;
+        *(verts++) = corners[3].y;
+
+        *(texcoords++) = minu;
+        *(texcoords++) = minv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = minv;
+        *(texcoords++) = minu;
+        *(texcoords++) = maxv;
+        *(texcoords++) = minu;
+        *(texcoords++) = maxv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = minv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = maxv;
+    }
+
+    return 0;
+}
+
 static void
 SetDrawState(GLES_RenderData *data, const SDL_RenderCommand *cmd)
 {
@@ -847,6 +910,7 @@ GLES_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vert
                 if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect)) != 0) {
                     SDL_memcpy(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect));
                     data->drawstate.viewport_dirty = SDL_TRUE;
+                    data->drawstate.cliprect_dirty = SDL_TRUE;  /* the scissor rect is offset by the viewport. */
                 }
                 break;
             }
@@ -953,6 +1017,16 @@ GLES_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vert
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                const size_t count = cmd->data.draw.count;
+                const GLfloat *verts = (GLfloat *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                SetCopyState(data, cmd);
+                data->glVertexPointer(2, GL_FLOAT, 0, verts);
+                data->glTexCoordPointer(2, GL_FLOAT, 0, verts + (count * 12));
+                data->glDrawArrays(GL_TRIANGLES, 0, (GLsizei) (count * 6));
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1163,6 +1237,7 @@ GLES_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = GLES_QueueFillRects;
     renderer->QueueCopy = GLES_QueueCopy;
     renderer->QueueCopyEx = GLES_QueueCopyEx;
+    renderer->QueueCopyBatch = GLES_QueueCopyBatch;
     renderer->RunCommandQueue = GLES_RunCommandQueue;
     renderer->RenderReadPixels = GLES_RenderReadPixels;
     renderer->RenderPresent = GLES_RenderPresent;
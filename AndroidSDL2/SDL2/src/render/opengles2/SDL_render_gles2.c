@@ -941,6 +941,64 @@ GLES2_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static int
+GLES2_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                     const SDL_RenderCopyItem * items, int count)
+{
+    GLfloat *verts = (GLfloat *) SDL_AllocateRenderVertices(renderer, count * 24 * sizeof (GLfloat), 0, &cmd->data.draw.first);
+    GLfloat *texcoords;
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    /* All the positions, then all the texture coordinates, as two triangles per copy */
+    texcoords = verts + (count * 12);
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcquad = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        GLfloat minu, maxu, minv, maxv;
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        minu = ((GLfloat) srcquad->x) / ((GLfloat) texture->w);
+        maxu = ((GLfloat) (srcquad->x + srcquad->w)) / ((GLfloat) texture->w);
+        minv = ((GLfloat) srcquad->y) / ((GLfloat) texture->h);
+        maxv = ((GLfloat) (srcquad->y + srcquad->h)) / ((GLfloat) texture->h);
+
+        *(verts++) = corners[0].x;
+        *(verts++) = corners[0].y;
+        *(verts++) = corners[1].x;
+        *(verts++) = corners[1].y;
+        *(verts++) = corners[2].x;
+        *(verts++) = corners[2].y;
+        *(verts++) = corners[2].x;
+        *(verts++) = corners[2].y;
+        *(verts++) = corners[1].x;
+        *(verts++) = corners[1].y;
+        *(verts++) = corners[3].x;
+        *(verts++) = corners[3].y;
+
+        *(texcoords++) = minu;
+        *(texcoords++) = minv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = minv;
+        *(texcoords++) = minu;
+        *(texcoords++) = maxv;
+        *(texcoords++) = minu;
+        *(texcoords++) = maxv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = minv;
+        *(texcoords++) = maxu;
+        *(texcoords++) = maxv;
+    }
+
+    return 0;
+}
+
 static int
 SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_ImageSource imgsrc)
 {
@@ -1017,7 +1075,9 @@ SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_I
     }
 
     if (texture) {
-        data->glVertexAttribPointer(GLES2_ATTRIBUTE_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 0, (const GLvoid *) (cmd->data.draw.first + (sizeof (GLfloat) * 8)));
+        /* Batched copies have all their positions before their texture coordinates */
+        const size_t texcoords = (cmd->command == SDL_RENDERCMD_COPY_BATCH) ? (cmd->data.draw.count * 12) : 8;
+        data->glVertexAttribPointer(GLES2_ATTRIBUTE_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 0, (const GLvoid *) (cmd->data.draw.first + (sizeof (GLfloat) * texcoords)));
     }
 
     if (GLES2_SelectProgram(data, imgsrc, texture ? texture->w : 0, texture ? texture->h : 0) < 0) {
@@ -1244,6 +1304,7 @@ GLES2_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 if (SDL_memcmp(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect)) != 0) {
                     SDL_memcpy(viewport, &cmd->data.viewport.rect, sizeof (SDL_Rect));
                     data->drawstate.viewport_dirty = SDL_TRUE;
+                    data->drawstate.cliprect_dirty = SDL_TRUE;  /* the scissor rect is offset by the viewport. */
                 }
                 break;
             }
@@ -1328,6 +1389,13 @@ GLES2_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                if (SetCopyState(renderer, cmd) == 0) {
+                    data->glDrawArrays(GL_TRIANGLES, 0, (GLsizei) (cmd->data.draw.count * 6));
+                }
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -2103,6 +2171,7 @@ GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
     renderer->QueueFillRects      = GLES2_QueueFillRects;
     renderer->QueueCopy           = GLES2_QueueCopy;
     renderer->QueueCopyEx         = GLES2_QueueCopyEx;
+    renderer->QueueCopyBatch      = GLES2_QueueCopyBatch;
     renderer->RunCommandQueue     = GLES2_RunCommandQueue;
     renderer->RenderReadPixels    = GLES2_RenderReadPixels;
     renderer->RenderPresent       = GLES2_RenderPresent;
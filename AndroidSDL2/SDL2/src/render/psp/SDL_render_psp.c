@@ -653,6 +653,47 @@ PSP_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * t
     return 0;
 }
 
+static int
+PSP_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                   const SDL_RenderCopyItem * items, int count)
+{
+    VertTV *verts = (VertTV *) SDL_AllocateRenderVertices(renderer, count * 6 * sizeof (VertTV), 4, &cmd->data.draw.first);
+    /* Two triangles per copy, made of these corners */
+    static const int quad[6] = { 0, 1, 2, 2, 1, 3 };
+    int i, j;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; i++) {
+        const SDL_Rect *srcrect = &items[i].srcrect;
+        SDL_FPoint corners[4];
+        float u[2], v[2];
+
+        SDL_GetRenderCopyCorners(&items[i], corners);
+
+        u[0] = srcrect->x;
+        u[1] = srcrect->x + srcrect->w;
+        v[0] = srcrect->y;
+        v[1] = srcrect->y + srcrect->h;
+
+        for (j = 0; j < 6; j++) {
+            const int corner = quad[j];
+            verts->u = u[corner & 1];
+            verts->v = v[corner >> 1];
+            verts->x = corners[corner].x;
+            verts->y = corners[corner].y;
+            verts->z = 0;
+            verts++;
+        }
+    }
+
+    return 0;
+}
+
 static void
 PSP_SetBlendMode(SDL_Renderer * renderer, int blendMode)
 {
@@ -848,6 +889,29 @@ PSP_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *verti
                 break;
             }
 
+            case SDL_RENDERCMD_COPY_BATCH: {
+                const size_t count = cmd->data.draw.count;
+                const VertTV *verts = (VertTV *) (gpumem + cmd->data.draw.first);
+                const Uint8 alpha = cmd->data.draw.a;
+                TextureActivate(cmd->data.draw.texture);
+                PSP_SetBlendMode(renderer, cmd->data.draw.blend);
+
+                if(alpha != 255) {  /* !!! FIXME: is this right? */
+                    sceGuTexFunc(GU_TFX_MODULATE, GU_TCC_RGBA);
+                    sceGuColor(GU_RGBA(255, 255, 255, alpha));
+                } else {
+                    sceGuTexFunc(GU_TFX_REPLACE, GU_TCC_RGBA);
+                    sceGuColor(0xFFFFFFFF);
+                }
+
+                sceGuDrawArray(GU_TRIANGLES, GU_TEXTURE_32BITF|GU_VERTEX_32BITF|GU_TRANSFORM_2D, 6 * count, 0, verts);
+
+                if(alpha != 255) {
+                    sceGuTexFunc(GU_TFX_REPLACE, GU_TCC_RGBA);
+                }
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -958,6 +1022,7 @@ PSP_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = PSP_QueueFillRects;
     renderer->QueueCopy = PSP_QueueCopy;
     renderer->QueueCopyEx = PSP_QueueCopyEx;
+    renderer->QueueCopyBatch = PSP_QueueCopyBatch;
     renderer->RunCommandQueue = PSP_RunCommandQueue;
     renderer->RenderReadPixels = PSP_RenderReadPixels;
     renderer->RenderPresent = PSP_RenderPresent;
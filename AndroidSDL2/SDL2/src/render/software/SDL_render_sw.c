@@ -26,6 +26,8 @@
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_thread.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -34,9 +36,19 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "../../thread/SDL_systhread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_RLEaccel_c.h"
 
 /* SDL surface based renderer implementation */
 
+/* Size of the screen tiles used by the threaded command queue */
+#define SW_TILE_SIZE        128
+#define SW_MAX_TILE_THREADS 64
+
+/* Number of separate rects the damage on the window surface is kept in */
+#define SW_MAX_DAMAGE_RECTS 16
+
 typedef struct
 {
     const SDL_Rect *viewport;
@@ -44,10 +56,90 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* A queued command that can be split across tiles */
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect cliprect;          /* clip rect in effect when the command was queued */
+    SDL_Rect bounds;            /* area touched by the command, inside cliprect */
+    int texture;                /* index into SW_TilePool::textures, or -1 */
+} SW_TileCommand;
+
+typedef struct SW_TilePool SW_TilePool;
+
+typedef struct
+{
+    SW_TilePool *pool;
+    SDL_Thread *thread;
+    SDL_Surface *surface;       /* private view of the target's pixels */
+    SDL_Surface **textures;     /* private views of the textures' pixels */
+    int max_textures;
+} SW_TileWorker;
+
+/* Flushes a surface's views are kept for after it was last drawn with */
+#define SW_TILE_VIEW_MAX_AGE 64
+
+/* Every worker's view of one surface, kept across flushes while the
+   surface keeps the same pixels and layout */
+typedef struct
+{
+    SDL_Surface *surface;
+    void *pixels;
+    int w, h, pitch;
+    Uint32 format;
+    Uint32 last_used;
+    SDL_Surface **views;        /* indexed by worker, worker 0 has none */
+} SW_TileView;
+
+struct SW_TilePool
+{
+    int num_workers;            /* worker 0 is the thread running the queue */
+    SW_TileWorker *workers;
+    SDL_sem *work_sem;
+    SDL_sem *done_sem;
+    SDL_atomic_t next_tile;
+    SDL_bool quit;
+
+    /* The batch currently being rasterized */
+    void *vertices;
+    SW_TileCommand *commands;
+    int num_commands;
+    int max_commands;
+    SDL_Surface **textures;
+    int num_textures;
+    int max_textures;
+    int tiles_x;
+    int tiles_y;
+    int *bins;                  /* first entry of each tile, num_tiles + 1 entries */
+    int max_bins;
+    int *entries;               /* command indices, grouped by tile */
+    int max_entries;
+
+    SW_TileView *views;
+    int num_views;
+    int max_views;
+    Uint32 num_flushes;
+};
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TilePool *tiles;
+
+    /* What was drawn to the window surface since the last clear or present */
+    SDL_Rect damage[SW_MAX_DAMAGE_RECTS];
+    int num_damage;
+    SDL_bool frame_cleared;
+    Uint32 frame_clear_color;
+
+    /* What is on screen on top of the color it was last cleared to */
+    SDL_Rect overdraw[SW_MAX_DAMAGE_RECTS];
+    int num_overdraw;
+    SDL_bool background_known;
+    Uint32 background;
+
+    SDL_bool present_full;      /* the screen doesn't match the window surface */
 } SW_RenderData;
 
 
@@ -63,6 +155,10 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            data->num_damage = 0;
+            data->frame_cleared = SDL_FALSE;
+            data->background_known = SDL_FALSE;
+            data->present_full = SDL_TRUE;
         }
     }
     return data->surface;
@@ -76,6 +172,8 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        data->present_full = SDL_TRUE;
     }
 }
 
@@ -215,18 +313,9 @@ SW_QueueDrawPoints(SDL_Renderer * renderer, SDL_RenderCommand *cmd, const SDL_FP
 
     cmd->data.draw.count = count;
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        const int x = renderer->viewport.x;
-        const int y = renderer->viewport.y;
-        for (i = 0; i < count; i++, verts++, points++) {
-            verts->x = (int)(x + points->x);
-            verts->y = (int)(y + points->y);
-        }
-    } else {
-        for (i = 0; i < count; i++, verts++, points++) {
-            verts->x = (int)points->x;
-            verts->y = (int)points->y;
-        }
+    for (i = 0; i < count; i++, verts++, points++) {
+        verts->x = (int)points->x;
+        verts->y = (int)points->y;
     }
 
     return 0;
@@ -244,23 +333,11 @@ SW_QueueFillRects(SDL_Renderer * renderer, SDL_RenderCommand *cmd, const SDL_FRe
 
     cmd->data.draw.count = count;
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        const int x = renderer->viewport.x;
-        const int y = renderer->viewport.y;
-
-        for (i = 0; i < count; i++, verts++, rects++) {
-            verts->x = (int)(x + rects->x);
-            verts->y = (int)(y + rects->y);
-            verts->w = SDL_max((int)rects->w, 1);
-            verts->h = SDL_max((int)rects->h, 1);
-        }
-    } else {
-        for (i = 0; i < count; i++, verts++, rects++) {
-            verts->x = (int)rects->x;
-            verts->y = (int)rects->y;
-            verts->w = SDL_max((int)rects->w, 1);
-            verts->h = SDL_max((int)rects->h, 1);
-        }
+    for (i = 0; i < count; i++, verts++, rects++) {
+        verts->x = (int)rects->x;
+        verts->y = (int)rects->y;
+        verts->w = SDL_max((int)rects->w, 1);
+        verts->h = SDL_max((int)rects->h, 1);
     }
 
     return 0;
@@ -281,13 +358,8 @@ SW_QueueCopy(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * text
     SDL_memcpy(verts, srcrect, sizeof (SDL_Rect));
     verts++;
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        verts->x = (int)(renderer->viewport.x + dstrect->x);
-        verts->y = (int)(renderer->viewport.y + dstrect->y);
-    } else {
-        verts->x = (int)dstrect->x;
-        verts->y = (int)dstrect->y;
-    }
+    verts->x = (int)dstrect->x;
+    verts->y = (int)dstrect->y;
     verts->w = (int)dstrect->w;
     verts->h = (int)dstrect->h;
 
@@ -318,13 +390,8 @@ SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
 
     SDL_memcpy(&verts->srcrect, srcrect, sizeof (SDL_Rect));
 
-    if (renderer->viewport.x || renderer->viewport.y) {
-        verts->dstrect.x = (int)(renderer->viewport.x + dstrect->x);
-        verts->dstrect.y = (int)(renderer->viewport.y + dstrect->y);
-    } else {
-        verts->dstrect.x = (int)dstrect->x;
-        verts->dstrect.y = (int)dstrect->y;
-    }
+    verts->dstrect.x = (int)dstrect->x;
+    verts->dstrect.y = (int)dstrect->y;
     verts->dstrect.w = (int)dstrect->w;
     verts->dstrect.h = (int)dstrect->h;
     verts->angle = angle;
@@ -335,16 +402,90 @@ SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
 }
 
 static int
-SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * texture,
+SW_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                  const SDL_RenderCopyItem * items, int count)
+{
+    CopyExData *verts = (CopyExData *) SDL_AllocateRenderVertices(renderer, count * sizeof (CopyExData), 0, &cmd->data.draw.first);
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; ++i, ++verts) {
+        const SDL_RenderCopyItem *item = &items[i];
+
+        SDL_memcpy(&verts->srcrect, &item->srcrect, sizeof (SDL_Rect));
+        verts->dstrect.x = (int)item->dstrect.x;
+        verts->dstrect.y = (int)item->dstrect.y;
+        verts->dstrect.w = (int)item->dstrect.w;
+        verts->dstrect.h = (int)item->dstrect.h;
+        verts->angle = item->angle;
+        verts->center.x = item->dstrect.w / 2.0f;
+        verts->center.y = item->dstrect.h / 2.0f;
+        verts->flip = item->flip;
+    }
+
+    return 0;
+}
+
+static void
+SW_GetRotatedRect(const SDL_Rect * final_rect, const double angle, const SDL_FPoint * center,
+                  SDL_Rect * rotated_rect, double * cangle, double * sangle)
+{
+    int dstwidth, dstheight, abscenterx, abscentery;
+    double s, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
+
+    SDLgfx_rotozoomSurfaceSizeTrig(final_rect->w, final_rect->h, angle, &dstwidth, &dstheight, cangle, sangle);
+
+    /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
+    abscenterx = final_rect->x + (int)center->x;
+    abscentery = final_rect->y + (int)center->y;
+    /* Compensate the angle inversion to match the behaviour of the other backends */
+    s = -*sangle;
+
+    /* Top Left */
+    px = final_rect->x - abscenterx;
+    py = final_rect->y - abscentery;
+    p1x = px * *cangle - py * s + abscenterx;
+    p1y = px * s + py * *cangle + abscentery;
+
+    /* Top Right */
+    px = final_rect->x + final_rect->w - abscenterx;
+    py = final_rect->y - abscentery;
+    p2x = px * *cangle - py * s + abscenterx;
+    p2y = px * s + py * *cangle + abscentery;
+
+    /* Bottom Left */
+    px = final_rect->x - abscenterx;
+    py = final_rect->y + final_rect->h - abscentery;
+    p3x = px * *cangle - py * s + abscenterx;
+    p3y = px * s + py * *cangle + abscentery;
+
+    /* Bottom Right */
+    px = final_rect->x + final_rect->w - abscenterx;
+    py = final_rect->y + final_rect->h - abscentery;
+    p4x = px * *cangle - py * s + abscenterx;
+    p4y = px * s + py * *cangle + abscentery;
+
+    rotated_rect->x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
+    rotated_rect->y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
+    rotated_rect->w = dstwidth;
+    rotated_rect->h = dstheight;
+}
+
+static int
+SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Surface *src, const int smooth,
                 const SDL_Rect * srcrect, const SDL_Rect * final_rect,
                 const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip)
 {
-    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-    SDL_Rect tmp_rect;
+    SDL_Rect tmp_rect, rotated_rect;
     SDL_Surface *src_clone, *src_rotated, *src_scaled;
     SDL_Surface *mask = NULL, *mask_rotated = NULL;
-    int retval = 0, dstwidth, dstheight, abscenterx, abscentery;
-    double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
+    int retval = 0;
+    double cangle, sangle;
     SDL_BlendMode blendmode;
     Uint8 alphaMod, rMod, gMod, bMod;
     int applyModulation = SDL_FALSE;
@@ -355,6 +496,23 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
         return -1;
     }
 
+    /* 32-bit surfaces are rotated, scaled and blended straight onto the target,
+     * without creating any intermediate surfaces.
+     */
+    if (SDLgfx_rotateBlitSupported(src, surface)) {
+        SW_GetRotatedRect(final_rect, angle, center, &rotated_rect, &cangle, &sangle);
+        if (SDL_MUSTLOCK(src)) {
+            SDL_LockSurface(src);
+        }
+        retval = SDLgfx_rotateBlit(src, srcrect, final_rect->w, final_rect->h, surface, &rotated_rect,
+                                   angle, smooth, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
+                                   cangle, sangle);
+        if (SDL_MUSTLOCK(src)) {
+            SDL_UnlockSurface(src);
+        }
+        return retval;
+    }
+
     tmp_rect.x = 0;
     tmp_rect.y = 0;
     tmp_rect.w = final_rect->w;
@@ -446,53 +604,20 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
     SDL_SetSurfaceBlendMode(src_clone, blendmode);
 
     if (!retval) {
-        SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, &dstwidth, &dstheight, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle, dstwidth/2, dstheight/2, (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
+        SW_GetRotatedRect(final_rect, angle, center, &rotated_rect, &cangle, &sangle);
+        src_rotated = SDLgfx_rotateSurface(src_clone, angle, rotated_rect.w/2, rotated_rect.h/2, smooth, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, rotated_rect.w, rotated_rect.h, cangle, sangle);
         if (src_rotated == NULL) {
             retval = -1;
         }
         if (!retval && mask != NULL) {
             /* The mask needed for the NONE blend mode gets rotated with the same parameters. */
-            mask_rotated = SDLgfx_rotateSurface(mask, angle, dstwidth/2, dstheight/2, SDL_FALSE, 0, 0, dstwidth, dstheight, cangle, sangle);
+            mask_rotated = SDLgfx_rotateSurface(mask, angle, rotated_rect.w/2, rotated_rect.h/2, SDL_FALSE, 0, 0, rotated_rect.w, rotated_rect.h, cangle, sangle);
             if (mask_rotated == NULL) {
                 retval = -1;
             }
         }
         if (!retval) {
-            /* Find out where the new origin is by rotating the four final_rect points around the center and then taking the extremes */
-            abscenterx = final_rect->x + (int)center->x;
-            abscentery = final_rect->y + (int)center->y;
-            /* Compensate the angle inversion to match the behaviour of the other backends */
-            sangle = -sangle;
-
-            /* Top Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y - abscentery;
-            p1x = px * cangle - py * sangle + abscenterx;
-            p1y = px * sangle + py * cangle + abscentery;
-
-            /* Top Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y - abscentery;
-            p2x = px * cangle - py * sangle + abscenterx;
-            p2y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Left */
-            px = final_rect->x - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p3x = px * cangle - py * sangle + abscenterx;
-            p3y = px * sangle + py * cangle + abscentery;
-
-            /* Bottom Right */
-            px = final_rect->x + final_rect->w - abscenterx;
-            py = final_rect->y + final_rect->h - abscentery;
-            p4x = px * cangle - py * sangle + abscenterx;
-            p4y = px * sangle + py * cangle + abscentery;
-
-            tmp_rect.x = (int)MIN(MIN(p1x, p2x), MIN(p3x, p4x));
-            tmp_rect.y = (int)MIN(MIN(p1y, p2y), MIN(p3y, p4y));
-            tmp_rect.w = dstwidth;
-            tmp_rect.h = dstheight;
+            tmp_rect = rotated_rect;
 
             /* The NONE blend mode needs some special care with non-opaque surfaces.
              * Other blend modes or opaque surfaces can be blitted directly.
@@ -562,15 +687,13 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
 }
 
 static void
-PrepTextureForCopy(const SDL_RenderCommand *cmd)
+PrepTextureForCopy(const SDL_RenderCommand *cmd, SDL_Surface *surface)
 {
     const Uint8 r = cmd->data.draw.r;
     const Uint8 g = cmd->data.draw.g;
     const Uint8 b = cmd->data.draw.b;
     const Uint8 a = cmd->data.draw.a;
     const SDL_BlendMode blend = cmd->data.draw.blend;
-    SDL_Texture *texture = cmd->data.draw.texture;
-    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
     const SDL_bool colormod = ((r & g & b) != 0xFF);
     const SDL_bool alphamod = (a != 0xFF);
     const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL));
@@ -585,39 +708,987 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+static void
+GetDrawStateClipRect(const SW_DrawStateCache *drawstate, SDL_Rect *rect)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
+
+    if (cliprect != NULL) {
+        SDL_Rect clip_rect;
+        clip_rect.x = cliprect->x + viewport->x;
+        clip_rect.y = cliprect->y + viewport->y;
+        clip_rect.w = cliprect->w;
+        clip_rect.h = cliprect->h;
+        SDL_IntersectRect(viewport, &clip_rect, rect);
+    } else {
+        *rect = *viewport;
+    }
+}
+
+/* The vertices are queued relative to the viewport, so that recorded command
+ * lists can be replayed at a different offset. Move them onto the surface.
+ */
+static void
+SW_OffsetCommandVertices(const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *viewport)
+{
+    const int x = viewport ? viewport->x : 0;
+    const int y = viewport ? viewport->y : 0;
+    const int count = (int) cmd->data.draw.count;
+    int i;
+
+    if (!x && !y) {
+        return;
+    }
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; ++i) {
+                verts[i].x += x;
+                verts[i].y += y;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; ++i) {
+                verts[i].x += x;
+                verts[i].y += y;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            SDL_Rect *dstrect = ((SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first)) + 1;
+            dstrect->x += x;
+            dstrect->y += y;
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY_BATCH: {
+            CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; ++i) {
+                copydata[i].dstrect.x += x;
+                copydata[i].dstrect.y += y;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/* Damage tracking.
+ *
+ * Everything drawn to the window surface is recorded as a few rects, and only
+ * those are presented. When a frame starts by clearing to the same color as the
+ * previous one, the clear itself changes nothing outside of what the previous
+ * frame drew on top of it, so that is presented along with the new drawing.
+ */
+
+static int
+SW_GetRectArea(const SDL_Rect *rect)
+{
+    return rect->w * rect->h;
+}
+
+static void
+SW_AddDamageRect(SDL_Rect *rects, int *count, const SDL_Rect *rect)
+{
+    SDL_Rect merged = *rect;
+    int i, best = -1, best_growth = 0;
+
+    if (SDL_RectEmpty(rect)) {
+        return;
+    }
+
+    /* Merge while the union isn't bigger than the two rects side by side */
+    for (i = 0; i < *count; ++i) {
+        SDL_Rect rect_union;
+        int growth;
+        SDL_UnionRect(&rects[i], &merged, &rect_union);
+        growth = SW_GetRectArea(&rect_union) - SW_GetRectArea(&rects[i]) - SW_GetRectArea(&merged);
+        if (growth <= 0) {
+            merged = rect_union;
+            rects[i] = rects[--*count];
+            i = -1;  /* the bigger rect may merge with one that was checked already */
+            best = -1;
+        } else if (best < 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+
+    if (*count == SW_MAX_DAMAGE_RECTS) {
+        /* No room left, grow the rect that gains the least */
+        SDL_UnionRect(&rects[best], &merged, &rects[best]);
+    } else {
+        rects[(*count)++] = merged;
+    }
+}
+
+/* Gets the area a command may draw to, it doesn't have to be tight */
+static void
+SW_GetCommandDamage(const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *cliprect, SDL_Rect *rect)
+{
+    const int count = (int) cmd->data.draw.count;
+    int i;
+
+    SDL_zerop(rect);
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            SDL_EnclosePoints(verts, count, NULL, rect);
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; ++i) {
+                SDL_UnionRect(rect, &verts[i], rect);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            *rect = verts[1];
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY_BATCH: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; ++i, ++copydata) {
+                SDL_Rect rotated_rect;
+                double cangle, sangle;
+                SW_GetRotatedRect(&copydata->dstrect, copydata->angle, &copydata->center, &rotated_rect, &cangle, &sangle);
+                SDL_UnionRect(rect, &rotated_rect, rect);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if (!SDL_IntersectRect(rect, cliprect, rect)) {
+        SDL_zerop(rect);
+    }
+}
+
+static void
+SW_AddCommandDamage(SW_RenderData *data, const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *cliprect)
+{
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        /* Everything drawn before is gone */
+        data->num_damage = 0;
+        data->frame_cleared = SDL_TRUE;
+        data->frame_clear_color = SDL_MapRGBA(data->window->format, cmd->data.color.r, cmd->data.color.g,
+                                              cmd->data.color.b, cmd->data.color.a);
+    } else {
+        SDL_Rect rect, surface_rect;
+        surface_rect.x = 0;
+        surface_rect.y = 0;
+        surface_rect.w = data->window->w;
+        surface_rect.h = data->window->h;
+        SW_GetCommandDamage(cmd, vertices, cliprect, &rect);
+        if (SDL_IntersectRect(&rect, &surface_rect, &rect)) {
+            SW_AddDamageRect(data->damage, &data->num_damage, &rect);
+        }
+    }
+}
+
 static void
 SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     if (drawstate->surface_cliprect_dirty) {
-        const SDL_Rect *viewport = drawstate->viewport;
-        const SDL_Rect *cliprect = drawstate->cliprect;
-        SDL_assert(viewport != NULL);  /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
-
-        if (cliprect != NULL) {
-            SDL_Rect clip_rect;
-            clip_rect.x = cliprect->x + viewport->x;
-            clip_rect.y = cliprect->y + viewport->y;
-            clip_rect.w = cliprect->w;
-            clip_rect.h = cliprect->h;
-            SDL_IntersectRect(viewport, &clip_rect, &clip_rect);
-            SDL_SetClipRect(surface, &clip_rect);
+        SDL_Rect clip_rect;
+        GetDrawStateClipRect(drawstate, &clip_rect);
+        SDL_SetClipRect(surface, &clip_rect);
+        drawstate->surface_cliprect_dirty = SDL_FALSE;
+    }
+}
+
+static void
+SW_RenderCopy(SDL_Surface *surface, SDL_Surface *src, const SDL_Rect * srcrect,
+              const SDL_Rect * final_rect, const SDL_ScaleMode scaleMode)
+{
+    SDL_Rect dstrect = *final_rect;  /* the blit writes back the clipped rect */
+
+    if ( srcrect->w == dstrect.w && srcrect->h == dstrect.h ) {
+        SDL_BlitSurface(src, srcrect, surface, &dstrect);
+    } else {
+        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+         * to avoid potentially frequent RLE encoding/decoding.
+         */
+        SDL_SetSurfaceRLE(surface, 0);
+        SDL_PrivateUpperBlitScaled(src, srcrect, surface, &dstrect,
+                                   (scaleMode == SDL_ScaleModeNearest) ? SDL_BLIT_SCALE_NEAREST : SDL_BLIT_SCALE_LINEAR);
+    }
+}
+
+/* Draws a command, other than a clear, with the surface clip rect already set up */
+static void
+SW_DrawCommand(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Surface *src,
+               const SDL_RenderCommand *cmd, void *vertices)
+{
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            PrepTextureForCopy(cmd, src);
+            SW_RenderCopy(surface, src, &verts[0], &verts[1], cmd->data.draw.texture->scaleMode);
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const int smooth = (cmd->data.draw.texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1;
+            PrepTextureForCopy(cmd, src);
+            SW_RenderCopyEx(renderer, surface, src, smooth, &copydata->srcrect,
+                            &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_BATCH: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const int count = (int) cmd->data.draw.count;
+            const SDL_ScaleMode scaleMode = cmd->data.draw.texture->scaleMode;
+            const int smooth = (scaleMode == SDL_ScaleModeNearest) ? 0 : 1;
+            int i;
+            PrepTextureForCopy(cmd, src);
+            for (i = 0; i < count; ++i, ++copydata) {
+                if (copydata->angle == 0.0 && copydata->flip == SDL_FLIP_NONE) {
+                    SW_RenderCopy(surface, src, &copydata->srcrect, &copydata->dstrect, scaleMode);
+                } else {
+                    SW_RenderCopyEx(renderer, surface, src, smooth, &copydata->srcrect,
+                                    &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
+                }
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+
+/* Threaded command queue.
+ *
+ * Commands whose result doesn't depend on how they are clipped (clears, points,
+ * filled rects, unscaled copies and direct rotated copies) are collected into a
+ * batch and binned into SW_TILE_SIZE square tiles. The tiles are then rasterized
+ * in parallel, each one running its commands in queue order with the tile
+ * intersected into the clip rect. Every thread blits through its own surface structures that share the
+ * pixels of the real ones, because blitting changes the state of both surfaces.
+ * Anything else flushes the batch and runs on the calling thread.
+ */
+
+static SDL_Surface *
+SW_CreateSurfaceView(SDL_Surface *surface)
+{
+    const SDL_PixelFormat *format = surface->format;
+
+    return SDL_CreateRGBSurfaceFrom(surface->pixels, surface->w, surface->h,
+                                    format->BitsPerPixel, surface->pitch,
+                                    format->Rmask, format->Gmask,
+                                    format->Bmask, format->Amask);
+}
+
+static void
+SW_FreeTileView(SW_TilePool *pool, SW_TileView *view)
+{
+    int i;
+
+    if (view->views) {
+        for (i = 1; i < pool->num_workers; ++i) {
+            if (view->views[i]) {
+                SDL_FreeSurface(view->views[i]);
+            }
+        }
+        SDL_free(view->views);
+        view->views = NULL;
+    }
+}
+
+/* Returns the index of the workers' views of surface, creating them if they
+   don't exist yet or the surface has changed since, or -1 on failure */
+static int
+SW_GetTileView(SW_TilePool *pool, SDL_Surface *surface)
+{
+    SW_TileView *view = NULL;
+    int i;
+
+    for (i = 0; i < pool->num_views; ++i) {
+        if (pool->views[i].surface == surface) {
+            view = &pool->views[i];
+            break;
+        }
+    }
+
+    if (view) {
+        if (view->pixels == surface->pixels && view->w == surface->w && view->h == surface->h &&
+            view->pitch == surface->pitch && view->format == surface->format->format) {
+            view->last_used = pool->num_flushes;
+            return i;
+        }
+        SW_FreeTileView(pool, view);
+    } else {
+        if (pool->num_views == pool->max_views) {
+            const int max_views = pool->max_views ? (pool->max_views * 2) : 16;
+            SW_TileView *views = (SW_TileView *) SDL_realloc(pool->views, max_views * sizeof (*views));
+            if (!views) {
+                return -1;
+            }
+            pool->views = views;
+            pool->max_views = max_views;
+        }
+        view = &pool->views[pool->num_views++];
+        view->views = NULL;
+    }
+
+    view->surface = surface;
+    view->pixels = surface->pixels;
+    view->w = surface->w;
+    view->h = surface->h;
+    view->pitch = surface->pitch;
+    view->format = surface->format->format;
+    view->last_used = pool->num_flushes;
+    view->views = (SDL_Surface **) SDL_calloc(pool->num_workers, sizeof (*view->views));
+    for (i = 1; view->views && i < pool->num_workers; ++i) {
+        view->views[i] = SW_CreateSurfaceView(surface);
+        if (!view->views[i]) {
+            break;
+        }
+    }
+    if (!view->views || i < pool->num_workers) {
+        SW_FreeTileView(pool, view);
+        *view = pool->views[--pool->num_views];
+        return -1;
+    }
+    return (int) (view - pool->views);
+}
+
+/* Drops the views of surfaces that haven't been drawn with for a while */
+static void
+SW_AgeTileViews(SW_TilePool *pool)
+{
+    int i = 0;
+
+    while (i < pool->num_views) {
+        SW_TileView *view = &pool->views[i];
+        if ((pool->num_flushes - view->last_used) > SW_TILE_VIEW_MAX_AGE) {
+            SW_FreeTileView(pool, view);
+            *view = pool->views[--pool->num_views];
         } else {
-            SDL_SetClipRect(surface, drawstate->viewport);
+            ++i;
         }
-        drawstate->surface_cliprect_dirty = SDL_FALSE;
     }
 }
 
+/* Points each worker at its own views of the target and this batch's textures */
+static SDL_bool
+SW_SetupTileViews(SW_TilePool *pool, SDL_Surface *surface)
+{
+    int i, j, view;
+
+    for (i = 1; i < pool->num_workers; ++i) {
+        SW_TileWorker *worker = &pool->workers[i];
+        if (pool->num_textures > worker->max_textures) {
+            SDL_Surface **textures = (SDL_Surface **) SDL_realloc(worker->textures, pool->max_textures * sizeof (*textures));
+            if (!textures) {
+                return SDL_FALSE;
+            }
+            worker->textures = textures;
+            worker->max_textures = pool->max_textures;
+        }
+    }
+
+    view = SW_GetTileView(pool, surface);
+    if (view < 0) {
+        return SDL_FALSE;
+    }
+    for (i = 1; i < pool->num_workers; ++i) {
+        pool->workers[i].surface = pool->views[view].views[i];
+    }
+
+    for (j = 0; j < pool->num_textures; ++j) {
+        view = SW_GetTileView(pool, pool->textures[j]);
+        if (view < 0) {
+            return SDL_FALSE;
+        }
+        for (i = 1; i < pool->num_workers; ++i) {
+            pool->workers[i].textures[j] = pool->views[view].views[i];
+        }
+    }
+    return SDL_TRUE;
+}
+
+static void
+SW_DrawTileCommand(SDL_Surface *surface, SDL_Surface **textures, const SW_TileCommand *tilecmd,
+                   const SDL_Rect *cliprect, void *vertices)
+{
+    const SDL_RenderCommand *cmd = tilecmd->cmd;
+
+    SDL_SetClipRect(surface, cliprect);
+
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        const Uint8 r = cmd->data.color.r;
+        const Uint8 g = cmd->data.color.g;
+        const Uint8 b = cmd->data.color.b;
+        const Uint8 a = cmd->data.color.a;
+        SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
+    } else {
+        SDL_Surface *src = (tilecmd->texture >= 0) ? textures[tilecmd->texture] : NULL;
+        SW_DrawCommand(NULL, surface, src, cmd, vertices);
+    }
+}
+
+static void
+SW_RunTiles(SW_TilePool *pool, SW_TileWorker *worker)
+{
+    const int num_tiles = pool->tiles_x * pool->tiles_y;
+    int tile;
+
+    while ((tile = SDL_AtomicAdd(&pool->next_tile, 1)) < num_tiles) {
+        SDL_Rect tilerect;
+        int i;
+
+        tilerect.x = (tile % pool->tiles_x) * SW_TILE_SIZE;
+        tilerect.y = (tile / pool->tiles_x) * SW_TILE_SIZE;
+        tilerect.w = SW_TILE_SIZE;
+        tilerect.h = SW_TILE_SIZE;
+
+        for (i = pool->bins[tile]; i < pool->bins[tile + 1]; ++i) {
+            const SW_TileCommand *tilecmd = &pool->commands[pool->entries[i]];
+            SDL_Rect cliprect;
+
+            SDL_IntersectRect(&tilecmd->cliprect, &tilerect, &cliprect);
+            SW_DrawTileCommand(worker->surface, worker->textures, tilecmd, &cliprect, pool->vertices);
+        }
+    }
+}
+
+static int SDLCALL
+SW_TileThread(void *data)
+{
+    SW_TileWorker *worker = (SW_TileWorker *) data;
+    SW_TilePool *pool = worker->pool;
+
+    for ( ; ; ) {
+        SDL_SemWait(pool->work_sem);
+        if (pool->quit) {
+            break;
+        }
+        SW_RunTiles(pool, worker);
+        SDL_SemPost(pool->done_sem);
+    }
+    return 0;
+}
+
+static void
+SW_DestroyTilePool(SW_TilePool *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    pool->quit = SDL_TRUE;
+    for (i = 1; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_SemPost(pool->work_sem);
+        }
+    }
+    for (i = 1; i < pool->num_workers; ++i) {
+        if (pool->workers[i].thread) {
+            SDL_WaitThread(pool->workers[i].thread, NULL);
+        }
+    }
+
+    if (pool->work_sem) {
+        SDL_DestroySemaphore(pool->work_sem);
+    }
+    if (pool->done_sem) {
+        SDL_DestroySemaphore(pool->done_sem);
+    }
+    for (i = 0; i < pool->num_views; ++i) {
+        SW_FreeTileView(pool, &pool->views[i]);
+    }
+    SDL_free(pool->views);
+    if (pool->workers) {
+        for (i = 1; i < pool->num_workers; ++i) {
+            SDL_free(pool->workers[i].textures);
+        }
+    }
+    SDL_free(pool->workers);
+    SDL_free(pool->commands);
+    SDL_free(pool->textures);
+    SDL_free(pool->bins);
+    SDL_free(pool->entries);
+    SDL_free(pool);
+}
+
+static SW_TilePool *
+SW_CreateTilePool(int num_workers)
+{
+    SW_TilePool *pool;
+    int i;
+
+    pool = (SW_TilePool *) SDL_calloc(1, sizeof (*pool));
+    if (!pool) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    pool->num_workers = num_workers;
+    pool->workers = (SW_TileWorker *) SDL_calloc(num_workers, sizeof (*pool->workers));
+    pool->work_sem = SDL_CreateSemaphore(0);
+    pool->done_sem = SDL_CreateSemaphore(0);
+    if (!pool->workers || !pool->work_sem || !pool->done_sem) {
+        SW_DestroyTilePool(pool);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    for (i = 0; i < num_workers; ++i) {
+        pool->workers[i].pool = pool;
+    }
+    for (i = 1; i < num_workers; ++i) {
+        pool->workers[i].thread = SDL_CreateThreadInternal(SW_TileThread, "SDLRenderSW", 0, &pool->workers[i]);
+        if (!pool->workers[i].thread) {
+            SW_DestroyTilePool(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+static int
+SW_AddTileTexture(SW_TilePool *pool, SDL_Surface *src)
+{
+    int i;
+
+    for (i = pool->num_textures - 1; i >= 0; --i) {
+        if (pool->textures[i] == src) {
+            return i;
+        }
+    }
+
+    if (pool->num_textures == pool->max_textures) {
+        const int max_textures = pool->max_textures ? (pool->max_textures * 2) : 16;
+        SDL_Surface **textures = (SDL_Surface **) SDL_realloc(pool->textures, max_textures * sizeof (*textures));
+        if (!textures) {
+            return -1;
+        }
+        pool->textures = textures;
+        pool->max_textures = max_textures;
+    }
+
+#if SDL_HAVE_RLE
+    /* The threads read the pixels directly, so RLE encoding is permanently disabled */
+    if (src->flags & SDL_RLEACCEL) {
+        SDL_SetSurfaceRLE(src, 0);
+        SDL_UnRLESurface(src, 1);
+    }
+#endif
+
+    pool->textures[pool->num_textures] = src;
+    return pool->num_textures++;
+}
+
+static SDL_bool
+SW_QueueTileCommand(SW_TilePool *pool, const SDL_RenderCommand *cmd,
+                    const SDL_Rect *cliprect, const SDL_Rect *bounds)
+{
+    SW_TileCommand *tilecmd;
+    int texture = -1;
+
+    if (cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX ||
+        cmd->command == SDL_RENDERCMD_COPY_BATCH) {
+        texture = SW_AddTileTexture(pool, (SDL_Surface *) cmd->data.draw.texture->driverdata);
+        if (texture < 0) {
+            return SDL_FALSE;
+        }
+    }
+
+    if (pool->num_commands == pool->max_commands) {
+        const int max_commands = pool->max_commands ? (pool->max_commands * 2) : 256;
+        SW_TileCommand *commands = (SW_TileCommand *) SDL_realloc(pool->commands, max_commands * sizeof (*commands));
+        if (!commands) {
+            return SDL_FALSE;
+        }
+        pool->commands = commands;
+        pool->max_commands = max_commands;
+    }
+
+    tilecmd = &pool->commands[pool->num_commands++];
+    tilecmd->cmd = cmd;
+    tilecmd->cliprect = *cliprect;
+    tilecmd->bounds = *bounds;
+    tilecmd->texture = texture;
+    return SDL_TRUE;
+}
+
+/* Sorts the batched commands into per-tile lists, keeping them in queue order */
+static SDL_bool
+SW_BinTileCommands(SW_TilePool *pool, SDL_Surface *surface)
+{
+    const int tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    const int tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    const int num_tiles = tiles_x * tiles_y;
+    int *cursor;
+    int i, tx, ty, total;
+
+    /* The start of each tile, plus a fill cursor per tile */
+    if ((2 * num_tiles + 1) > pool->max_bins) {
+        int *bins = (int *) SDL_realloc(pool->bins, (2 * num_tiles + 1) * sizeof (int));
+        if (!bins) {
+            return SDL_FALSE;
+        }
+        pool->bins = bins;
+        pool->max_bins = 2 * num_tiles + 1;
+    }
+    cursor = pool->bins + num_tiles + 1;
+    SDL_memset(pool->bins, 0, (num_tiles + 1) * sizeof (int));
+
+    for (i = 0; i < pool->num_commands; ++i) {
+        const SDL_Rect *bounds = &pool->commands[i].bounds;
+        for (ty = bounds->y / SW_TILE_SIZE; ty <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++ty) {
+            for (tx = bounds->x / SW_TILE_SIZE; tx <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++tx) {
+                ++pool->bins[ty * tiles_x + tx + 1];
+            }
+        }
+    }
+
+    for (i = 0; i < num_tiles; ++i) {
+        pool->bins[i + 1] += pool->bins[i];
+        cursor[i] = pool->bins[i];
+    }
+
+    total = pool->bins[num_tiles];
+    if (total > pool->max_entries) {
+        int *entries = (int *) SDL_realloc(pool->entries, total * sizeof (int));
+        if (!entries) {
+            return SDL_FALSE;
+        }
+        pool->entries = entries;
+        pool->max_entries = total;
+    }
+
+    for (i = 0; i < pool->num_commands; ++i) {
+        const SDL_Rect *bounds = &pool->commands[i].bounds;
+        for (ty = bounds->y / SW_TILE_SIZE; ty <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++ty) {
+            for (tx = bounds->x / SW_TILE_SIZE; tx <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++tx) {
+                pool->entries[cursor[ty * tiles_x + tx]++] = i;
+            }
+        }
+    }
+
+    pool->tiles_x = tiles_x;
+    pool->tiles_y = tiles_y;
+    return SDL_TRUE;
+}
+
+static void
+SW_FlushTiles(SW_TilePool *pool, SDL_Surface *surface)
+{
+    int i;
+
+    if (pool->num_commands == 0) {
+        return;
+    }
+
+    ++pool->num_flushes;
+    if (SW_BinTileCommands(pool, surface) && SW_SetupTileViews(pool, surface)) {
+        /* Worker 0 is this thread, it uses the real surfaces */
+        pool->workers[0].surface = surface;
+        pool->workers[0].textures = pool->textures;
+
+        SDL_AtomicSet(&pool->next_tile, 0);
+        for (i = 1; i < pool->num_workers; ++i) {
+            SDL_SemPost(pool->work_sem);
+        }
+        SW_RunTiles(pool, &pool->workers[0]);
+        for (i = 1; i < pool->num_workers; ++i) {
+            SDL_SemWait(pool->done_sem);
+        }
+    } else {
+        /* Couldn't set up the threads, run the batch here without splitting it */
+        for (i = 0; i < pool->num_commands; ++i) {
+            SW_DrawTileCommand(surface, pool->textures, &pool->commands[i],
+                               &pool->commands[i].cliprect, pool->vertices);
+        }
+    }
+
+    SW_AgeTileViews(pool);
+
+    pool->num_commands = 0;
+    pool->num_textures = 0;
+}
+
+/* Returns SDL_FALSE if the command doesn't draw the same pixels when it's split into tiles */
+static SDL_bool
+SW_GetTileCommandBounds(SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices,
+                        const SDL_Rect *cliprect, SDL_Rect *bounds)
+{
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            if (!SDL_EnclosePoints(verts, count, cliprect, bounds)) {
+                SDL_zerop(bounds);
+            }
+            return SDL_TRUE;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            int i;
+            SDL_zerop(bounds);
+            for (i = 0; i < count; ++i) {
+                SDL_UnionRect(bounds, &verts[i], bounds);
+            }
+            SDL_IntersectRect(bounds, cliprect, bounds);
+            return SDL_TRUE;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_Rect *srcrect = verts;
+            const SDL_Rect *dstrect = verts + 1;
+            if (srcrect->w != dstrect->w || srcrect->h != dstrect->h) {
+                return SDL_FALSE;  /* scaled blits round differently when clipped */
+            }
+            SDL_IntersectRect(dstrect, cliprect, bounds);
+            return SDL_TRUE;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            SDL_Rect rotated_rect;
+            double cangle, sangle;
+            if (!SDLgfx_rotateBlitSupported((SDL_Surface *) cmd->data.draw.texture->driverdata, surface)) {
+                return SDL_FALSE;  /* the fallback blits an intermediate surface, which clips differently */
+            }
+            SW_GetRotatedRect(&copydata->dstrect, copydata->angle, &copydata->center, &rotated_rect, &cangle, &sangle);
+            SDL_IntersectRect(&rotated_rect, cliprect, bounds);
+            return SDL_TRUE;
+        }
+
+        case SDL_RENDERCMD_COPY_BATCH: {
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const int count = (int) cmd->data.draw.count;
+            const SDL_bool rotate_blit = SDLgfx_rotateBlitSupported((SDL_Surface *) cmd->data.draw.texture->driverdata, surface);
+            int i;
+            SDL_zerop(bounds);
+            for (i = 0; i < count; ++i, ++copydata) {
+                SDL_Rect rect;
+                if (copydata->angle == 0.0 && copydata->flip == SDL_FLIP_NONE) {
+                    if (copydata->srcrect.w != copydata->dstrect.w || copydata->srcrect.h != copydata->dstrect.h) {
+                        return SDL_FALSE;
+                    }
+                    rect = copydata->dstrect;
+                } else {
+                    double cangle, sangle;
+                    if (!rotate_blit) {
+                        return SDL_FALSE;
+                    }
+                    SW_GetRotatedRect(&copydata->dstrect, copydata->angle, &copydata->center, &rect, &cangle, &sangle);
+                }
+                if (SDL_IntersectRect(&rect, cliprect, &rect)) {
+                    SDL_UnionRect(bounds, &rect, bounds);
+                }
+            }
+            return SDL_TRUE;
+        }
+
+        default:
+            return SDL_FALSE;
+    }
+}
+
+static int
+SW_RunCommandQueueTiled(SDL_Renderer * renderer, SDL_Surface *surface, SW_TilePool *pool,
+                        SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    const SDL_bool track_damage = (renderer->window && surface == data->window);
+    SW_DrawStateCache drawstate;
+    SDL_Rect surface_rect;
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
+
+    surface_rect.x = 0;
+    surface_rect.y = 0;
+    surface_rect.w = surface->w;
+    surface_rect.h = surface->h;
+
+    pool->vertices = vertices;
+
+    while (cmd) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETDRAWCOLOR: {
+                break;  /* Not used in this backend. */
+            }
+
+            case SDL_RENDERCMD_SETVIEWPORT: {
+                drawstate.viewport = &cmd->data.viewport.rect;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_SETCLIPRECT: {
+                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_CLEAR: {
+                /* By definition the clear ignores the clip rect */
+                SDL_Rect bounds;
+                bounds.x = 0;
+                bounds.y = 0;
+                bounds.w = surface->w;
+                bounds.h = surface->h;
+                if (track_damage) {
+                    SW_AddCommandDamage(data, cmd, vertices, &bounds);
+                }
+                if (!SW_QueueTileCommand(pool, cmd, &bounds, &bounds)) {
+                    const Uint8 r = cmd->data.color.r;
+                    const Uint8 g = cmd->data.color.g;
+                    const Uint8 b = cmd->data.color.b;
+                    const Uint8 a = cmd->data.color.a;
+                    SW_FlushTiles(pool, surface);
+                    SDL_SetClipRect(surface, NULL);
+                    SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
+                }
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+            case SDL_RENDERCMD_COPY_BATCH: {
+                SDL_Rect cliprect, bounds;
+                SW_OffsetCommandVertices(cmd, vertices, drawstate.viewport);
+                GetDrawStateClipRect(&drawstate, &cliprect);
+                SDL_IntersectRect(&cliprect, &surface_rect, &cliprect);  /* the viewport can extend past the surface */
+                if (track_damage) {
+                    SW_AddCommandDamage(data, cmd, vertices, &cliprect);
+                }
+                if (SW_GetTileCommandBounds(surface, cmd, vertices, &cliprect, &bounds)) {
+                    if (SDL_RectEmpty(&bounds) || SW_QueueTileCommand(pool, cmd, &cliprect, &bounds)) {
+                        break;
+                    }
+                }
+                /* This command has to be drawn in one go, after everything before it */
+                SW_FlushTiles(pool, surface);
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                SetDrawState(surface, &drawstate);
+                if (cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_COPY_EX ||
+                    cmd->command == SDL_RENDERCMD_COPY_BATCH) {
+                    SW_DrawCommand(renderer, surface, (SDL_Surface *) cmd->data.draw.texture->driverdata, cmd, vertices);
+                } else {
+                    SW_DrawCommand(renderer, surface, NULL, cmd, vertices);
+                }
+                break;
+            }
+
+            case SDL_RENDERCMD_NO_OP:
+                break;
+        }
+
+        cmd = cmd->next;
+    }
+
+    SW_FlushTiles(pool, surface);
+
+    return 0;
+}
+
 static int
 SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
+    SDL_bool track_damage;
 
     if (!surface) {
         return -1;
     }
 
+    if (data->tiles) {
+        return SW_RunCommandQueueTiled(renderer, surface, data->tiles, cmd, vertices);
+    }
+
+    track_damage = (renderer->window && surface == data->window);
+
     drawstate.viewport = NULL;
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = SDL_TRUE;
@@ -649,89 +1720,33 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 SDL_SetClipRect(surface, NULL);
                 SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
                 drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
-            }
-
-            case SDL_RENDERCMD_DRAW_POINTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
-                }
-                break;
-            }
-
-            case SDL_RENDERCMD_DRAW_LINES: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+                if (track_damage) {
+                    SW_AddCommandDamage(data, cmd, vertices, NULL);
                 }
                 break;
             }
 
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
             case SDL_RENDERCMD_FILL_RECTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
+                SW_OffsetCommandVertices(cmd, vertices, drawstate.viewport);
                 SetDrawState(surface, &drawstate);
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+                if (track_damage) {
+                    SW_AddCommandDamage(data, cmd, vertices, &surface->clip_rect);
                 }
+                SW_DrawCommand(renderer, surface, NULL, cmd, vertices);
                 break;
             }
 
-            case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
-                SDL_Texture *texture = cmd->data.draw.texture;
-                SDL_Surface *src = (SDL_Surface *) texture->driverdata;
-
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+            case SDL_RENDERCMD_COPY_BATCH: {
+                SW_OffsetCommandVertices(cmd, vertices, drawstate.viewport);
                 SetDrawState(surface, &drawstate);
-
-                PrepTextureForCopy(cmd);
-
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+                if (track_damage) {
+                    SW_AddCommandDamage(data, cmd, vertices, &surface->clip_rect);
                 }
-                break;
-            }
-
-            case SDL_RENDERCMD_COPY_EX: {
-                const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                SetDrawState(surface, &drawstate);
-                PrepTextureForCopy(cmd);
-                SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                                &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip);
+                SW_DrawCommand(renderer, surface, (SDL_Surface *) cmd->data.draw.texture->driverdata, cmd, vertices);
                 break;
             }
 
@@ -779,11 +1794,58 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
+    SDL_Rect rects[2 * SW_MAX_DAMAGE_RECTS];
+    int num_rects = 0;
+    int area = 0;
+    int i;
+
+    if (!window) {
+        return;
+    }
 
-    if (window) {
+    if (!data->window) {
         SDL_UpdateWindowSurface(window);
+        return;
     }
+
+    if (data->frame_cleared) {
+        if (!data->background_known || data->background != data->frame_clear_color) {
+            data->present_full = SDL_TRUE;
+        }
+        /* Whatever the previous frames drew is cleared away now */
+        SDL_memcpy(rects, data->overdraw, data->num_overdraw * sizeof (SDL_Rect));
+        num_rects = data->num_overdraw;
+        SDL_memcpy(data->overdraw, data->damage, data->num_damage * sizeof (SDL_Rect));
+        data->num_overdraw = data->num_damage;
+        data->background_known = SDL_TRUE;
+        data->background = data->frame_clear_color;
+    } else if (data->background_known) {
+        for (i = 0; i < data->num_damage; ++i) {
+            SW_AddDamageRect(data->overdraw, &data->num_overdraw, &data->damage[i]);
+        }
+    }
+    SDL_memcpy(&rects[num_rects], data->damage, data->num_damage * sizeof (SDL_Rect));
+    num_rects += data->num_damage;
+
+    /* Past half of the surface, a single update is cheaper than many small ones */
+    for (i = 0; i < num_rects; ++i) {
+        area += SW_GetRectArea(&rects[i]);
+    }
+    if (area > (data->window->w * data->window->h) / 2) {
+        data->present_full = SDL_TRUE;
+    }
+
+    if (data->present_full) {
+        SDL_UpdateWindowSurface(window);
+    } else if (num_rects > 0) {
+        SDL_UpdateWindowSurfaceRects(window, rects, num_rects);
+    }
+
+    data->num_damage = 0;
+    data->frame_cleared = SDL_FALSE;
+    data->present_full = SDL_FALSE;
 }
 
 static void
@@ -799,6 +1861,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_DestroyTilePool(data->tiles);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -808,6 +1873,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
 
     if (!surface) {
         SDL_SetError("Can't create renderer for NULL surface");
@@ -828,6 +1894,16 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->present_full = SDL_TRUE;
+
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    if (hint) {
+        const int num_threads = SDL_min(SDL_atoi(hint), SW_MAX_TILE_THREADS);
+        if (num_threads > 1) {
+            /* If the threads can't be started, the command queue runs serially */
+            data->tiles = SW_CreateTilePool(num_threads);
+        }
+    }
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -844,6 +1920,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->QueueFillRects = SW_QueueFillRects;
     renderer->QueueCopy = SW_QueueCopy;
     renderer->QueueCopyEx = SW_QueueCopyEx;
+    renderer->QueueCopyBatch = SW_QueueCopyBatch;
     renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
@@ -40,7 +40,13 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 #include <string.h>
 
 #include "SDL.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_rotate.h"
+#include "../../cpuinfo/SDL_cpuinfo_c.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
 
 /* ---- Internally used structures */
 
@@ -535,4 +541,419 @@ SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery,
     return rz_dst;
 }
 
+/* ---- Direct rotated blits */
+
+/* !
+\brief Blending state for a direct rotated blit.
+
+Pixels are blended in a working layout that has the destination's red, green
+and blue positions, and the source alpha in the remaining byte.
+*/
+typedef struct tRotateBlend {
+    Uint32 blendmode;       /* SDL_BlendMode of the source */
+    Uint32 convert;         /* nonzero if the source layout differs from the working layout */
+    Uint32 srcshift[4];     /* source R, G, B and A shifts */
+    Uint32 srcalpha;        /* nonzero if the source has an alpha channel */
+    Uint32 dstshift[4];     /* working R, G, B and A shifts */
+    Uint32 dstalpha;        /* nonzero if the destination has an alpha channel */
+    Uint32 alphamask;       /* mask of the working alpha byte */
+    Uint32 modulate;        /* nonzero if the color or alpha modulation isn't 255 */
+    Uint32 mod;             /* modulation in the working layout */
+} tRotateBlend;
+
+/* !
+\brief Returns the shift of the byte not used by the red, green and blue channels of a 8888 pixel.
+*/
+static Uint32
+_freeShift(const SDL_PixelFormat *format)
+{
+    return 48 - (format->Rshift + format->Gshift + format->Bshift);
+}
+
+/* !
+\brief Converts a source pixel to the working layout.
+*/
+static SDL_INLINE Uint32
+_convertPixel(Uint32 pixel, const tRotateBlend *blend)
+{
+    Uint32 a;
+
+    if (!blend->convert) {
+        return blend->srcalpha ? pixel : (pixel | blend->alphamask);
+    }
+    a = blend->srcalpha ? ((pixel >> blend->srcshift[3]) & 0xff) : 0xff;
+    return (((pixel >> blend->srcshift[0]) & 0xff) << blend->dstshift[0]) |
+           (((pixel >> blend->srcshift[1]) & 0xff) << blend->dstshift[1]) |
+           (((pixel >> blend->srcshift[2]) & 0xff) << blend->dstshift[2]) |
+           (a << blend->dstshift[3]);
+}
+
+/* !
+\brief Blends a span of source pixels onto the destination, one pixel at a time.
+
+The arithmetic is the same as in SDL_Blit_Slow().
+*/
+static void
+_blendSpan(const Uint32 *src, Uint32 *dst, int n, const tRotateBlend *blend)
+{
+    const Uint32 ashift = blend->dstshift[3];
+    int i, c;
+
+    for (i = 0; i < n; i++) {
+        const Uint32 s = _convertPixel(src[i], blend);
+        const Uint32 d = dst[i];
+        Uint32 srcA = (s >> ashift) & 0xff;
+        Uint32 out = 0;
+
+        if (blend->modulate) {
+            srcA = (srcA * ((blend->mod >> ashift) & 0xff)) / 255;
+        }
+        for (c = 0; c < 4; c++) {
+            const Uint32 shift = blend->dstshift[c];
+            Uint32 srcC = (s >> shift) & 0xff;
+            Uint32 dstC = (d >> shift) & 0xff;
+
+            if (c == 3) {
+                srcC = srcA;
+            } else {
+                if (blend->modulate) {
+                    srcC = (srcC * ((blend->mod >> shift) & 0xff)) / 255;
+                }
+                if (blend->blendmode == SDL_BLENDMODE_BLEND || blend->blendmode == SDL_BLENDMODE_ADD) {
+                    srcC = (srcC * srcA) / 255;
+                }
+            }
+            switch (blend->blendmode) {
+            case SDL_BLENDMODE_BLEND:
+                dstC = srcC + ((255 - srcA) * dstC) / 255;
+                break;
+            case SDL_BLENDMODE_ADD:
+                if (c != 3) {
+                    dstC = SDL_min(srcC + dstC, 255);
+                }
+                break;
+            case SDL_BLENDMODE_MOD:
+                if (c != 3) {
+                    dstC = (srcC * dstC) / 255;
+                }
+                break;
+            case SDL_BLENDMODE_MUL:
+                dstC = SDL_min(((srcC * dstC) + (dstC * (255 - srcA))) / 255, 255);
+                break;
+            default:
+                dstC = srcC;
+                break;
+            }
+            out |= dstC << shift;
+        }
+        dst[i] = blend->dstalpha ? out : (out & ~blend->alphamask);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* x / 255 for 0 <= x <= 255*255, in 16-bit lanes */
+#define DIV255_EPU16(x) \
+    _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16((x), one), _mm_srli_epi16(_mm_add_epi16((x), one), 8)), 8)
+
+/* !
+\brief Blends a span of source pixels onto the destination, four pixels at a time.
+
+Gives the same results as _blendSpan(). SDL_BLENDMODE_MUL isn't handled here.
+*/
+static void
+_blendSpanSSE2(const Uint32 *src, Uint32 *dst, int n, const tRotateBlend *blend)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i bytemask = _mm_set1_epi32(0xff);
+    const __m128i amask = _mm_set1_epi32(blend->alphamask);
+    const __m128i amask16 = _mm_unpacklo_epi8(amask, zero);
+    const __m128i ff16 = _mm_set1_epi16(0xff);
+    const __m128i mod16 = _mm_unpacklo_epi8(_mm_set1_epi32(blend->mod), zero);
+    const __m128i ashift = _mm_cvtsi32_si128(blend->dstshift[3]);
+    const __m128i srcalpha = blend->srcalpha ? zero : amask;
+    const int premultiply = (blend->blendmode == SDL_BLENDMODE_BLEND || blend->blendmode == SDL_BLENDMODE_ADD);
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        __m128i a, slo, shi, alo, ahi, out;
+
+        if (blend->convert) {
+            __m128i c = zero;
+            int j;
+            for (j = 0; j < 3; j++) {
+                const __m128i channel = _mm_and_si128(_mm_srl_epi32(s, _mm_cvtsi32_si128(blend->srcshift[j])), bytemask);
+                c = _mm_or_si128(c, _mm_sll_epi32(channel, _mm_cvtsi32_si128(blend->dstshift[j])));
+            }
+            if (blend->srcalpha) {
+                const __m128i channel = _mm_and_si128(_mm_srl_epi32(s, _mm_cvtsi32_si128(blend->srcshift[3])), bytemask);
+                c = _mm_or_si128(c, _mm_sll_epi32(channel, ashift));
+            }
+            s = c;
+        }
+        s = _mm_or_si128(s, srcalpha);
+
+        slo = _mm_unpacklo_epi8(s, zero);
+        shi = _mm_unpackhi_epi8(s, zero);
+        if (blend->modulate) {
+            slo = DIV255_EPU16(_mm_mullo_epi16(slo, mod16));
+            shi = DIV255_EPU16(_mm_mullo_epi16(shi, mod16));
+        }
+
+        if (blend->blendmode == SDL_BLENDMODE_NONE) {
+            out = _mm_packus_epi16(slo, shi);
+        } else {
+            /* Spread each pixel's alpha over its four channels */
+            a = _mm_and_si128(_mm_srl_epi32(_mm_packus_epi16(slo, shi), ashift), bytemask);
+            a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+            a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+            alo = _mm_unpacklo_epi8(a, zero);
+            ahi = _mm_unpackhi_epi8(a, zero);
+            if (premultiply) {
+                /* The alpha channel itself is multiplied by 255 */
+                slo = DIV255_EPU16(_mm_mullo_epi16(slo, _mm_or_si128(alo, amask16)));
+                shi = DIV255_EPU16(_mm_mullo_epi16(shi, _mm_or_si128(ahi, amask16)));
+            }
+            switch (blend->blendmode) {
+            case SDL_BLENDMODE_BLEND: {
+                const __m128i dlo = _mm_unpacklo_epi8(d, zero);
+                const __m128i dhi = _mm_unpackhi_epi8(d, zero);
+                slo = _mm_add_epi16(slo, DIV255_EPU16(_mm_mullo_epi16(_mm_sub_epi16(ff16, alo), dlo)));
+                shi = _mm_add_epi16(shi, DIV255_EPU16(_mm_mullo_epi16(_mm_sub_epi16(ff16, ahi), dhi)));
+                out = _mm_packus_epi16(slo, shi);
+                break;
+            }
+            case SDL_BLENDMODE_ADD:
+                out = _mm_adds_epu8(_mm_packus_epi16(slo, shi), d);
+                out = _mm_or_si128(_mm_andnot_si128(amask, out), _mm_and_si128(amask, d));
+                break;
+            default: {  /* SDL_BLENDMODE_MOD */
+                const __m128i dlo = _mm_unpacklo_epi8(d, zero);
+                const __m128i dhi = _mm_unpackhi_epi8(d, zero);
+                slo = DIV255_EPU16(_mm_mullo_epi16(slo, dlo));
+                shi = DIV255_EPU16(_mm_mullo_epi16(shi, dhi));
+                out = _mm_packus_epi16(slo, shi);
+                out = _mm_or_si128(_mm_andnot_si128(amask, out), _mm_and_si128(amask, d));
+                break;
+            }
+            }
+        }
+
+        if (!blend->dstalpha) {
+            out = _mm_andnot_si128(amask, out);
+        }
+        _mm_storeu_si128((__m128i *) (dst + i), out);
+    }
+
+    /* Finish the last few pixels */
+    _blendSpan(src + i, dst + i, n - i, blend);
+}
+
+#undef DIV255_EPU16
+#endif /* HAVE_SSE2_INTRINSICS */
+
+/* !
+\brief Returns whether SDLgfx_rotateBlit() can blit between two surfaces.
+*/
+SDL_bool
+SDLgfx_rotateBlitSupported(SDL_Surface * src, SDL_Surface * dst)
+{
+    return (src->format->BitsPerPixel == 32 && SDL_PIXELLAYOUT(src->format->format) == SDL_PACKEDLAYOUT_8888 &&
+            dst->format->BitsPerPixel == 32 && SDL_PIXELLAYOUT(dst->format->format) == SDL_PACKEDLAYOUT_8888);
+}
+
+/* !
+\brief Rotates, scales and flips a rectangle of a 32-bit 'src' surface straight onto the 'dst' surface.
+
+This produces the same pixels as scaling 'srcrect' to 'width' x 'height', rotating the result
+with SDLgfx_rotateSurface() and blitting the rotated surface to 'dstrect', without any of the
+intermediate surfaces. Destination pixels are scanned inside 'dstrect' and the clip rectangle
+of 'dst', mapped back into the source and sampled directly, then blended with the blend mode,
+color and alpha modulation of 'src'. Pixels that map outside of the source are left alone.
+Both surfaces must pass SDLgfx_rotateBlitSupported() and the source must not be RLE encoded.
+
+\param src The source surface.
+\param srcrect The area of the source surface to copy.
+\param width The width of the copy before the rotation.
+\param height The height of the copy before the rotation.
+\param dst The destination surface.
+\param dstrect The area covered by the rotated copy, as calculated by SDLgfx_rotozoomSurfaceSizeTrig().
+\param angle The angle to rotate in degrees.
+\param smooth Antialiasing flag; set to SMOOTHING_ON to enable.
+\param flipx Set to 1 to flip the image horizontally
+\param flipy Set to 1 to flip the image vertically
+\param cangle The angle cosine
+\param sangle The angle sine
+\return 0 on success.
+
+*/
+int
+SDLgfx_rotateBlit(SDL_Surface * src, const SDL_Rect * srcrect, int width, int height,
+                  SDL_Surface * dst, const SDL_Rect * dstrect, double angle, int smooth,
+                  int flipx, int flipy, double cangle, double sangle)
+{
+    Uint32 span[256];
+    tRotateBlend blend;
+    SDL_BlendMode blendmode;
+    SDL_Rect clip;
+    Uint8 r, g, b, a;
+    Sint64 ax, ay, xx, xy, yx, yy;
+    int angle90, x, y, sw, sh;
+    const Uint8 *srcpixels;
+    void (*blendSpan)(const Uint32 *, Uint32 *, int, const tRotateBlend *) = _blendSpan;
+
+    if (width <= 0 || height <= 0 || srcrect->w <= 0 || srcrect->h <= 0 ||
+        !SDL_IntersectRect(dstrect, &dst->clip_rect, &clip)) {
+        return 0;
+    }
+
+    /* Set up the blending */
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    blend.blendmode = blendmode;
+    blend.srcshift[0] = src->format->Rshift;
+    blend.srcshift[1] = src->format->Gshift;
+    blend.srcshift[2] = src->format->Bshift;
+    blend.srcshift[3] = src->format->Amask ? src->format->Ashift : _freeShift(src->format);
+    blend.srcalpha = (src->format->Amask != 0);
+    blend.dstshift[0] = dst->format->Rshift;
+    blend.dstshift[1] = dst->format->Gshift;
+    blend.dstshift[2] = dst->format->Bshift;
+    blend.dstshift[3] = dst->format->Amask ? dst->format->Ashift : _freeShift(dst->format);
+    blend.dstalpha = (dst->format->Amask != 0);
+    blend.alphamask = 0xffu << blend.dstshift[3];
+    blend.convert = (blend.srcshift[0] != blend.dstshift[0] || blend.srcshift[1] != blend.dstshift[1] ||
+                     blend.srcshift[2] != blend.dstshift[2]);
+    blend.modulate = ((r & g & b & a) != 255);
+    blend.mod = ((Uint32) r << blend.dstshift[0]) | ((Uint32) g << blend.dstshift[1]) |
+                ((Uint32) b << blend.dstshift[2]) | ((Uint32) a << blend.dstshift[3]);
+
+#if HAVE_SSE2_INTRINSICS
+    if (blendmode != SDL_BLENDMODE_MUL && (SDL_GetCPUDispatch(SDL_CPU_KERNEL_ROTATE) & CPU_HAS_SSE2)) {
+        blendSpan = _blendSpanSSE2;
+    }
+#endif
+
+    /* Map the rotated rectangle back into the unrotated copy, in 16.16 fixed point:
+     * copy_x = ax + x * xx + y * xy, copy_y = ay + x * yx + y * yy
+     */
+    angle90 = (int)(angle/90);
+    if (angle90 == angle/90) {
+        /* Multiples of 90 degrees map exactly, like transformSurfaceRGBA90() */
+        angle90 %= 4;
+        if (angle90 < 0) angle90 += 4; /* 0:0 deg, 1:90 deg, 2:180 deg, 3:270 deg */
+        switch (angle90) {
+        case 0: ax = 0; ay = 0; xx = 1; xy = 0; yx = 0; yy = 1; break;
+        case 1: ax = 0; ay = height - 1; xx = 0; xy = 1; yx = -1; yy = 0; break;
+        case 2: ax = width - 1; ay = height - 1; xx = -1; xy = 0; yx = 0; yy = -1; break;
+        case 3: default: ax = width - 1; ay = 0; xx = 0; xy = -1; yx = 1; yy = 0; break;
+        }
+        ax <<= 16; ay <<= 16; xx <<= 16; xy <<= 16; yx <<= 16; yy <<= 16;
+        smooth = 0;
+    } else {
+        /* The same mapping as _transformSurfaceRGBA() */
+        const int isin = (int)(sangle*65536.0);
+        const int icos = (int)(cangle*65536.0);
+        const int cx = dstrect->w / 2;
+        const int cy = dstrect->h / 2;
+        ax = ((Sint64)cx << 16) - (Sint64)icos * cx + ((Sint64)(width - dstrect->w) << 15) + (Sint64)isin * cy;
+        ay = ((Sint64)cy << 16) - (Sint64)isin * cx + ((Sint64)(height - dstrect->h) << 15) - (Sint64)icos * cy;
+        xx = icos; xy = -isin;
+        yx = isin; yy = icos;
+    }
+
+    /* Scale the copy coordinates to source coordinates */
+    if (width != srcrect->w) {
+        const Sint64 scale = ((Sint64)srcrect->w << 16) / width;
+        ax = (ax * scale) >> 16; xx = (xx * scale) >> 16; xy = (xy * scale) >> 16;
+    }
+    if (height != srcrect->h) {
+        const Sint64 scale = ((Sint64)srcrect->h << 16) / height;
+        ay = (ay * scale) >> 16; yx = (yx * scale) >> 16; yy = (yy * scale) >> 16;
+    }
+
+    sw = srcrect->w - 1;
+    sh = srcrect->h - 1;
+    srcpixels = (const Uint8 *)src->pixels + srcrect->y * src->pitch + srcrect->x * 4;
+
+    for (y = clip.y; y < clip.y + clip.h; y++) {
+        const int ry = y - dstrect->y;
+        const int rx = clip.x - dstrect->x;
+        const int sdx0 = (int)(ax + rx * xx + ry * xy);
+        const int sdy0 = (int)(ay + rx * yx + ry * yy);
+        const int idx = (int)xx, idy = (int)yx;
+        int start = 0, end = clip.w;
+        Uint32 *dp;
+
+        /* The pixels that map inside the source form a single run on each row */
+#define ROTATE_INSIDE(k) (smooth ? \
+            (((sdx0 + (k) * idx) >> 16) >= (flipx ? 1 : 0) && ((sdx0 + (k) * idx) >> 16) < (flipx ? sw + 1 : sw) && \
+             ((sdy0 + (k) * idy) >> 16) >= (flipy ? 1 : 0) && ((sdy0 + (k) * idy) >> 16) < (flipy ? sh + 1 : sh)) : \
+            ((unsigned)((sdx0 + (k) * idx) >> 16) <= (unsigned)sw && (unsigned)((sdy0 + (k) * idy) >> 16) <= (unsigned)sh))
+        while (start < end && !ROTATE_INSIDE(start)) {
+            start++;
+        }
+        while (end > start && !ROTATE_INSIDE(end - 1)) {
+            end--;
+        }
+#undef ROTATE_INSIDE
+
+        dp = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch) + clip.x;
+        for (x = start; x < end; ) {
+            const int n = SDL_min(end - x, (int)SDL_arraysize(span));
+            int sdx = sdx0 + x * idx;
+            int sdy = sdy0 + x * idy;
+            Uint32 *sp = span, *se = span + n;
+
+            if (smooth) {
+                /* Same interpolation as _transformSurfaceRGBA(), on each byte of the pixel */
+                for ( ; sp != se; sp++, sdx += idx, sdy += idy) {
+                    int dx = sdx >> 16, dy = sdy >> 16, ex = sdx & 0xffff, ey = sdy & 0xffff, t1, t2, c;
+                    const Uint32 *row;
+                    Uint32 c00, c01, c10, c11, cswap, out = 0;
+                    if (flipx) dx = sw - dx;
+                    if (flipy) dy = sh - dy;
+                    row = (const Uint32 *)(srcpixels + dy * src->pitch) + dx;
+                    c00 = row[0];
+                    c01 = row[1];
+                    row = (const Uint32 *)((const Uint8 *)row + src->pitch);
+                    c10 = row[0];
+                    c11 = row[1];
+                    if (flipx) {
+                        cswap = c00; c00 = c01; c01 = cswap;
+                        cswap = c10; c10 = c11; c11 = cswap;
+                    }
+                    if (flipy) {
+                        cswap = c00; c00 = c10; c10 = cswap;
+                        cswap = c01; c01 = c11; c11 = cswap;
+                    }
+                    for (c = 0; c < 32; c += 8) {
+                        const int p00 = (c00 >> c) & 0xff, p01 = (c01 >> c) & 0xff;
+                        const int p10 = (c10 >> c) & 0xff, p11 = (c11 >> c) & 0xff;
+                        t1 = ((((p01 - p00) * ex) >> 16) + p00) & 0xff;
+                        t2 = ((((p11 - p10) * ex) >> 16) + p10) & 0xff;
+                        out |= (Uint32)(((((t2 - t1) * ey) >> 16) + t1) & 0xff) << c;
+                    }
+                    *sp = out;
+                }
+            } else {
+                for ( ; sp != se; sp++, sdx += idx, sdy += idy) {
+                    int dx = sdx >> 16, dy = sdy >> 16;
+                    if (flipx) dx = sw - dx;
+                    if (flipy) dy = sh - dy;
+                    *sp = ((const Uint32 *)(srcpixels + dy * src->pitch))[dx];
+                }
+            }
+
+            blendSpan(span, dp + x, n, &blend);
+            x += n;
+        }
+    }
+
+    return 0;
+}
+
 #endif /* SDL_VIDEO_RENDER_SW && !SDL_RENDER_DISABLED */
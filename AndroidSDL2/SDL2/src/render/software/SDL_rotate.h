@@ -28,5 +28,7 @@
 
 extern SDL_Surface *SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery, int smooth, int flipx, int flipy, int dstwidth, int dstheight, double cangle, double sangle);
 extern void SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle, int *dstwidth, int *dstheight, double *cangle, double *sangle);
+extern SDL_bool SDLgfx_rotateBlitSupported(SDL_Surface * src, SDL_Surface * dst);
+extern int SDLgfx_rotateBlit(SDL_Surface * src, const SDL_Rect * srcrect, int width, int height, SDL_Surface * dst, const SDL_Rect * dstrect, double angle, int smooth, int flipx, int flipy, double cangle, double sangle);
 
 #endif /* SDL_rotate_h_ */
@@ -29,6 +29,8 @@
 #include "SDL_stdinc.h"
 #include "SDL_atomic.h"
 #include "SDL_error.h"
+#include "SDL_assert.h"
+#include "SDL_cpuinfo.h"
 
 #ifndef HAVE_MALLOC
 #define LACKS_SYS_TYPES_H
@@ -5432,4 +5434,441 @@ void SDL_free(void *ptr)
     (void)SDL_AtomicDecRef(&s_mem.num_allocations);
 }
 
+/* Thread caching memory functions
+
+   Small allocations are rounded up to one of a few size classes. Each thread
+   keeps a free list per class, so most allocations and frees touch no shared
+   state at all. When a thread runs out of blocks it takes a batch from a
+   shared list for that class, and when it has too many it gives a batch back.
+   The shared lists hand surplus blocks back to the system allocator.
+
+   Every block starts with a small header recording its class, so blocks can
+   be freed on any thread.
+ */
+#if defined(_MSC_VER)
+#define SDL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SDL_THREAD_LOCAL __thread
+#endif
+
+#define TCACHE_MAGIC        0x53444C54  /* "SDLT" */
+#define TCACHE_LARGE        0xFFFFFFFF
+#define TCACHE_NUM_CLASSES  12
+#define TCACHE_MAX_SIZE     1024
+#define TCACHE_BATCH        32          /* blocks moved at once between a thread and the shared list */
+#define TCACHE_MAX_CACHED   (2 * TCACHE_BATCH)
+#define TCACHE_MAX_SHARED   1024        /* more free blocks than this per class go back to the system */
+
+typedef union
+{
+    struct {
+        Uint32 magic;
+        Uint32 sizeclass;
+        size_t size;        /* requested size, for large blocks */
+    } info;
+    Uint8 align[16];
+} SDL_TCacheHeader;
+
+typedef struct SDL_TCacheBlock
+{
+    struct SDL_TCacheBlock *next;
+} SDL_TCacheBlock;
+
+typedef struct
+{
+    SDL_TCacheBlock *head;
+    int count;
+    Uint32 allocations;     /* not yet added to the shared statistics */
+    Uint32 frees;
+} SDL_TCacheList;
+
+typedef struct
+{
+    SDL_SpinLock lock;
+    SDL_TCacheBlock *head;
+    int count;
+    Uint64 allocations;
+    Uint64 frees;
+    Uint64 refills;
+    Uint64 returns;
+    Uint64 system_blocks;
+    char cache_pad[SDL_CACHELINE_SIZE];
+} SDL_TCacheShared;
+
+static const size_t tcache_sizes[TCACHE_NUM_CLASSES] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024
+};
+
+/* Size class for each multiple of 16 bytes */
+static const Uint8 tcache_class_of[(TCACHE_MAX_SIZE / 16) + 1] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11
+};
+
+static SDL_TCacheShared tcache_shared[TCACHE_NUM_CLASSES];
+
+#ifdef SDL_THREAD_LOCAL
+static SDL_THREAD_LOCAL SDL_TCacheList tcache_lists[TCACHE_NUM_CLASSES];
+#endif
+
+static SDL_TCacheHeader *
+SDL_TCacheHeaderOf(void *mem)
+{
+    SDL_TCacheHeader *header = (SDL_TCacheHeader *)mem - 1;
+    SDL_assert(header->info.magic == TCACHE_MAGIC);
+    return header;
+}
+
+/* Move up to 'count' blocks from the shared list to 'list', allocating more if needed */
+static void
+SDL_TCacheRefill(SDL_TCacheList *list, int sizeclass, int count)
+{
+    SDL_TCacheShared *shared = &tcache_shared[sizeclass];
+    SDL_TCacheBlock *head;
+    int i, taken = 0;
+
+    SDL_AtomicLock(&shared->lock);
+    head = shared->head;
+    while (head && taken < count) {
+        SDL_TCacheBlock *next = head->next;
+        head->next = list->head;
+        list->head = head;
+        head = next;
+        ++taken;
+    }
+    shared->head = head;
+    shared->count -= taken;
+    shared->allocations += list->allocations;
+    shared->frees += list->frees;
+    ++shared->refills;
+    SDL_AtomicUnlock(&shared->lock);
+
+    list->count += taken;
+    list->allocations = 0;
+    list->frees = 0;
+
+    if (taken == 0) {
+        /* The shared list was empty, get a fresh batch from the system */
+        for (i = 0; i < count; ++i) {
+            SDL_TCacheHeader *header = (SDL_TCacheHeader *)real_malloc(sizeof(*header) + tcache_sizes[sizeclass]);
+            SDL_TCacheBlock *block;
+            if (!header) {
+                break;
+            }
+            header->info.magic = TCACHE_MAGIC;
+            header->info.sizeclass = sizeclass;
+            header->info.size = tcache_sizes[sizeclass];
+            block = (SDL_TCacheBlock *)(header + 1);
+            block->next = list->head;
+            list->head = block;
+            ++list->count;
+        }
+        if (i > 0) {
+            SDL_AtomicLock(&shared->lock);
+            shared->system_blocks += i;
+            SDL_AtomicUnlock(&shared->lock);
+        }
+    }
+}
+
+/* Move 'count' blocks from 'list' to the shared list */
+static void
+SDL_TCacheRelease(SDL_TCacheList *list, int sizeclass, int count)
+{
+    SDL_TCacheShared *shared = &tcache_shared[sizeclass];
+    SDL_TCacheBlock *first, *last, *surplus = NULL;
+    int i, room;
+
+    if (count <= 0) {
+        return;
+    }
+
+    first = last = list->head;
+    for (i = 1; i < count; ++i) {
+        last = last->next;
+    }
+    list->head = last->next;
+    list->count -= count;
+
+    SDL_AtomicLock(&shared->lock);
+    room = TCACHE_MAX_SHARED - shared->count;
+    if (room >= count) {
+        last->next = shared->head;
+        shared->head = first;
+        shared->count += count;
+    } else {
+        /* Keep what fits and give the rest back to the system */
+        surplus = first;
+        for (i = 0; i < room; ++i) {
+            SDL_TCacheBlock *next = surplus->next;
+            surplus->next = shared->head;
+            shared->head = surplus;
+            surplus = next;
+        }
+        last->next = NULL;
+        shared->count += SDL_max(room, 0);
+    }
+    shared->allocations += list->allocations;
+    shared->frees += list->frees;
+    ++shared->returns;
+    SDL_AtomicUnlock(&shared->lock);
+
+    list->allocations = 0;
+    list->frees = 0;
+
+    while (surplus) {
+        SDL_TCacheBlock *next = surplus->next;
+        real_free((SDL_TCacheHeader *)surplus - 1);
+        surplus = next;
+    }
+}
+
+void
+SDL_FlushThreadMemoryCache(void)
+{
+#ifdef SDL_THREAD_LOCAL
+    int i;
+
+    for (i = 0; i < TCACHE_NUM_CLASSES; ++i) {
+        SDL_TCacheRelease(&tcache_lists[i], i, tcache_lists[i].count);
+    }
+#endif
+}
+
+/* SDL_RunThread() flushes the cache of threads SDL created. Threads created
+   any other way are flushed by a pthread key destructor when they exit, which
+   is registered the first time the thread caches a block. The main thread's
+   cache is only given back when the process exits.
+ */
+#if defined(SDL_THREAD_LOCAL) && defined(SDL_THREAD_PTHREAD)
+#define SDL_TCACHE_THREAD_EXIT
+#include <pthread.h>
+
+static pthread_once_t tcache_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t tcache_key;
+static SDL_bool tcache_key_valid;
+static SDL_THREAD_LOCAL SDL_bool tcache_registered;
+
+static void
+SDL_TCacheThreadExit(void *unused)
+{
+    /* Frees made by later destructors register the thread again */
+    tcache_registered = SDL_FALSE;
+    SDL_FlushThreadMemoryCache();
+}
+
+static void
+SDL_TCacheCreateKey(void)
+{
+    tcache_key_valid = (pthread_key_create(&tcache_key, SDL_TCacheThreadExit) == 0);
+}
+
+static void
+SDL_TCacheRegisterThread(void)
+{
+    if (!tcache_registered) {
+        tcache_registered = SDL_TRUE;
+        pthread_once(&tcache_key_once, SDL_TCacheCreateKey);
+        if (tcache_key_valid) {
+            /* Any non-NULL value makes the destructor run */
+            pthread_setspecific(tcache_key, &tcache_key);
+        }
+    }
+}
+#endif /* SDL_THREAD_LOCAL && SDL_THREAD_PTHREAD */
+
+static void * SDLCALL
+SDL_TCacheMalloc(size_t size)
+{
+    SDL_TCacheBlock *block;
+    SDL_TCacheList *list;
+    int sizeclass;
+#ifndef SDL_THREAD_LOCAL
+    SDL_TCacheList local;
+#endif
+
+    if (size > TCACHE_MAX_SIZE) {
+        SDL_TCacheHeader *header;
+        if (size > (~(size_t)0 - sizeof(*header))) {
+            return NULL;
+        }
+        header = (SDL_TCacheHeader *)real_malloc(sizeof(*header) + size);
+        if (!header) {
+            return NULL;
+        }
+        header->info.magic = TCACHE_MAGIC;
+        header->info.sizeclass = TCACHE_LARGE;
+        header->info.size = size;
+        return header + 1;
+    }
+
+    sizeclass = tcache_class_of[(size + 15) / 16];
+#ifdef SDL_THREAD_LOCAL
+    list = &tcache_lists[sizeclass];
+    ++list->allocations;
+    if (!list->head) {
+#ifdef SDL_TCACHE_THREAD_EXIT
+        SDL_TCacheRegisterThread();
+#endif
+        SDL_TCacheRefill(list, sizeclass, TCACHE_BATCH);
+    }
+#else
+    /* Without thread local storage, go through the shared list every time */
+    SDL_zero(local);
+    list = &local;
+    ++list->allocations;
+    SDL_TCacheRefill(list, sizeclass, 1);
+#endif
+    block = list->head;
+    if (!block) {
+        return NULL;
+    }
+    list->head = block->next;
+    --list->count;
+    return block;
+}
+
+static void SDLCALL
+SDL_TCacheFree(void *mem)
+{
+    SDL_TCacheHeader *header;
+    SDL_TCacheBlock *block;
+    SDL_TCacheList *list;
+    int sizeclass;
+#ifndef SDL_THREAD_LOCAL
+    SDL_TCacheList local;
+#endif
+
+    if (!mem) {
+        return;
+    }
+
+    header = SDL_TCacheHeaderOf(mem);
+    if (header->info.sizeclass == TCACHE_LARGE) {
+        real_free(header);
+        return;
+    }
+
+    sizeclass = (int)header->info.sizeclass;
+#ifdef SDL_THREAD_LOCAL
+    list = &tcache_lists[sizeclass];
+#else
+    SDL_zero(local);
+    list = &local;
+#endif
+#ifdef SDL_TCACHE_THREAD_EXIT
+    if (!list->head) {
+        SDL_TCacheRegisterThread();
+    }
+#endif
+    block = (SDL_TCacheBlock *)mem;
+    block->next = list->head;
+    list->head = block;
+    ++list->count;
+    ++list->frees;
+#ifdef SDL_THREAD_LOCAL
+    if (list->count > TCACHE_MAX_CACHED) {
+        SDL_TCacheRelease(list, sizeclass, TCACHE_BATCH);
+    }
+#else
+    SDL_TCacheRelease(list, sizeclass, 1);
+#endif
+}
+
+static void * SDLCALL
+SDL_TCacheCalloc(size_t nmemb, size_t size)
+{
+    void *mem;
+
+    if (size && nmemb > (~(size_t)0 / size)) {
+        return NULL;
+    }
+    mem = SDL_TCacheMalloc(nmemb * size);
+    if (mem) {
+        SDL_memset(mem, 0, nmemb * size);
+    }
+    return mem;
+}
+
+static void * SDLCALL
+SDL_TCacheRealloc(void *mem, size_t size)
+{
+    SDL_TCacheHeader *header;
+    size_t oldsize;
+    void *newmem;
+
+    if (!mem) {
+        return SDL_TCacheMalloc(size);
+    }
+
+    header = SDL_TCacheHeaderOf(mem);
+    oldsize = header->info.size;
+    if (header->info.sizeclass == TCACHE_LARGE) {
+        if (size > TCACHE_MAX_SIZE) {
+            if (size > (~(size_t)0 - sizeof(*header))) {
+                return NULL;
+            }
+            header = (SDL_TCacheHeader *)real_realloc(header, sizeof(*header) + size);
+            if (!header) {
+                return NULL;
+            }
+            header->info.size = size;
+            return header + 1;
+        }
+    } else if (size <= oldsize) {
+        return mem;  /* still fits in its block */
+    }
+
+    newmem = SDL_TCacheMalloc(size);
+    if (!newmem) {
+        return NULL;
+    }
+    SDL_memcpy(newmem, mem, SDL_min(size, oldsize));
+    SDL_TCacheFree(mem);
+    return newmem;
+}
+
+void SDL_GetThreadCacheMemoryFunctions(SDL_malloc_func *malloc_func,
+                                       SDL_calloc_func *calloc_func,
+                                       SDL_realloc_func *realloc_func,
+                                       SDL_free_func *free_func)
+{
+    if (malloc_func) {
+        *malloc_func = SDL_TCacheMalloc;
+    }
+    if (calloc_func) {
+        *calloc_func = SDL_TCacheCalloc;
+    }
+    if (realloc_func) {
+        *realloc_func = SDL_TCacheRealloc;
+    }
+    if (free_func) {
+        *free_func = SDL_TCacheFree;
+    }
+}
+
+int SDL_GetThreadCacheMemoryStats(SDL_MemoryCacheStats *stats, int maxstats)
+{
+    int i;
+
+    if (stats) {
+        for (i = 0; i < SDL_min(maxstats, TCACHE_NUM_CLASSES); ++i) {
+            SDL_TCacheShared *shared = &tcache_shared[i];
+            SDL_AtomicLock(&shared->lock);
+            stats[i].size = tcache_sizes[i];
+            stats[i].allocations = shared->allocations;
+            stats[i].frees = shared->frees;
+            stats[i].refills = shared->refills;
+            stats[i].returns = shared->returns;
+            stats[i].system_blocks = shared->system_blocks;
+            stats[i].shared_blocks = shared->count;
+            SDL_AtomicUnlock(&shared->lock);
+        }
+    }
+    return TCACHE_NUM_CLASSES;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -301,6 +301,9 @@ SDL_RunThread(void *data)
             SDL_free(thread);
         }
     }
+
+    /* Nothing else will be freed on this thread, release its memory cache */
+    SDL_FlushThreadMemoryCache();
 }
 
 #ifdef SDL_CreateThread
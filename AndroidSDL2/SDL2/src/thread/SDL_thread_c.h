@@ -90,6 +90,10 @@ extern SDL_TLSData *SDL_Generic_GetTLSData(void);
  */
 extern int SDL_Generic_SetTLSData(SDL_TLSData *data);
 
+/* Give the blocks this thread has cached back to the shared heap,
+   defined in SDL_malloc.c */
+extern void SDL_FlushThreadMemoryCache(void);
+
 #endif /* SDL_thread_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
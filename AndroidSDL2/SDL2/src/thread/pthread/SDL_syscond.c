@@ -29,6 +29,108 @@
 #include "SDL_thread.h"
 #include "SDL_sysmutex_c.h"
 
+#if SDL_THREAD_PTHREAD_FUTEX
+
+/* Futex condition variable: waiters sleep on a sequence number that every
+   signal bumps, so a signal that lands between unlocking the mutex and
+   going to sleep makes the futex wait return at once instead of being
+   lost. Signals with nobody waiting don't make a syscall. */
+
+struct SDL_cond
+{
+    SDL_atomic_t sequence;
+    SDL_atomic_t waiters;
+};
+
+/* Create a condition variable */
+SDL_cond *
+SDL_CreateCond(void)
+{
+    SDL_cond *cond;
+
+    cond = (SDL_cond *) SDL_calloc(1, sizeof(SDL_cond));
+    if (!cond) {
+        SDL_OutOfMemory();
+    }
+    return (cond);
+}
+
+/* Destroy a condition variable */
+void
+SDL_DestroyCond(SDL_cond * cond)
+{
+    if (cond) {
+        SDL_free(cond);
+    }
+}
+
+/* Restart one of the threads that are waiting on the condition variable */
+int
+SDL_CondSignal(SDL_cond * cond)
+{
+    if (!cond) {
+        return SDL_SetError("Passed a NULL condition variable");
+    }
+
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_AtomicAdd(&cond->sequence, 1);
+        SDL_FutexWake(&cond->sequence.value, 1);
+    }
+    return 0;
+}
+
+/* Restart all threads that are waiting on the condition variable */
+int
+SDL_CondBroadcast(SDL_cond * cond)
+{
+    if (!cond) {
+        return SDL_SetError("Passed a NULL condition variable");
+    }
+
+    if (SDL_AtomicGet(&cond->waiters) > 0) {
+        SDL_AtomicAdd(&cond->sequence, 1);
+        SDL_FutexWake(&cond->sequence.value, SDL_MAX_SINT32);
+    }
+    return 0;
+}
+
+int
+SDL_CondWaitTimeout(SDL_cond * cond, SDL_mutex * mutex, Uint32 ms)
+{
+    int retval;
+    int sequence;
+
+    if (!cond) {
+        return SDL_SetError("Passed a NULL condition variable");
+    }
+
+    /* Register while still holding the mutex, so that anybody who changes
+       the predicate after we let go of it also sees us waiting. */
+    SDL_AtomicAdd(&cond->waiters, 1);
+    sequence = SDL_AtomicGet(&cond->sequence);
+    if (SDL_UnlockMutex(mutex) < 0) {
+        SDL_AtomicAdd(&cond->waiters, -1);
+        return -1;
+    }
+
+    retval = SDL_FutexWait(&cond->sequence.value, sequence, ms);
+
+    SDL_AtomicAdd(&cond->waiters, -1);
+    SDL_LockMutex(mutex);
+    return retval;
+}
+
+/* Wait on the condition variable, unlocking the provided mutex.
+   The mutex must be locked before entering this function!
+ */
+int
+SDL_CondWait(SDL_cond * cond, SDL_mutex * mutex)
+{
+    return SDL_CondWaitTimeout(cond, mutex, SDL_MUTEX_MAXWAIT);
+}
+
+#else
+
 struct SDL_cond
 {
     pthread_cond_t cond;
@@ -155,4 +257,6 @@ SDL_CondWait(SDL_cond * cond, SDL_mutex * mutex)
     return 0;
 }
 
+#endif /* SDL_THREAD_PTHREAD_FUTEX */
+
 /* vi: set ts=4 sw=4 expandtab: */
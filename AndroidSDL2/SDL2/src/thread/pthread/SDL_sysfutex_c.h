@@ -0,0 +1,124 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2020 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_sysfutex_c_h_
+#define SDL_sysfutex_c_h_
+
+/* On Linux (and Android) the mutex, semaphore and condition variable are
+   built directly on futexes: the uncontended paths are a single atomic
+   operation and never enter the kernel. Define SDL_THREAD_PTHREAD_FUTEX
+   to 0 to fall back to the pthread and POSIX semaphore wrappers.
+ */
+#ifndef SDL_THREAD_PTHREAD_FUTEX
+#if defined(__LINUX__) && (defined(__GNUC__) || defined(__clang__))
+#define SDL_THREAD_PTHREAD_FUTEX 1
+#else
+#define SDL_THREAD_PTHREAD_FUTEX 0
+#endif
+#endif
+
+#if SDL_THREAD_PTHREAD_FUTEX
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_mutex.h"
+
+#ifndef FUTEX_PRIVATE_FLAG
+#define FUTEX_WAIT_PRIVATE FUTEX_WAIT
+#define FUTEX_WAKE_PRIVATE FUTEX_WAKE
+#endif
+
+#if defined(__i386__) || defined(__x86_64__)
+#define SDL_FUTEX_PAUSE() __asm__ __volatile__("pause\n")
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+#define SDL_FUTEX_PAUSE() __asm__ __volatile__("yield\n")
+#else
+#define SDL_FUTEX_PAUSE()
+#endif
+
+/* A contended waiter pauses 1, 2, 4, ... 64 times between looks at the
+   futex word (a few microseconds in total) before going to sleep. */
+#define SDL_FUTEX_SPIN_ROUNDS 7
+
+/* Sleep while the futex word still holds 'expected'.
+   Returns SDL_MUTEX_TIMEDOUT if 'ms' elapsed, 0 otherwise (woken, the
+   value had already changed, or a signal interrupted the wait). */
+SDL_FORCE_INLINE int
+SDL_FutexWait(int *word, int expected, Uint32 ms)
+{
+    struct timespec timeout;
+    struct timespec *ptimeout = NULL;
+
+    if (ms != SDL_MUTEX_MAXWAIT) {
+        timeout.tv_sec = ms / 1000;
+        timeout.tv_nsec = (ms % 1000) * 1000000;
+        ptimeout = &timeout;
+    }
+    if (syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, ptimeout, NULL, 0) < 0 &&
+        errno == ETIMEDOUT) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    return 0;
+}
+
+SDL_FORCE_INLINE void
+SDL_FutexWake(int *word, int count)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/* Spinning only pays off if whoever holds the resource is running on
+   another CPU at the same time. */
+SDL_FORCE_INLINE int
+SDL_FutexSpinRounds(void)
+{
+    static int spin_rounds = -1;
+    int rounds = __atomic_load_n(&spin_rounds, __ATOMIC_RELAXED);
+
+    if (rounds < 0) {
+        rounds = (SDL_GetCPUCount() > 1) ? SDL_FUTEX_SPIN_ROUNDS : 0;
+        __atomic_store_n(&spin_rounds, rounds, __ATOMIC_RELAXED);
+    }
+    return rounds;
+}
+
+SDL_FORCE_INLINE void
+SDL_FutexBackoff(int round)
+{
+    int i;
+
+    for (i = (1 << round); i > 0; --i) {
+        SDL_FUTEX_PAUSE();
+    }
+}
+
+#endif /* SDL_THREAD_PTHREAD_FUTEX */
+
+#endif /* SDL_sysfutex_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
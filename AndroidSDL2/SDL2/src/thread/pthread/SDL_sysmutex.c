@@ -24,6 +24,154 @@
 #include <pthread.h>
 
 #include "SDL_thread.h"
+#include "SDL_sysfutex_c.h"
+
+#if SDL_THREAD_PTHREAD_FUTEX
+#include "SDL_sysmutex_c.h"
+
+/* Futex mutex, after Drepper's "Futexes Are Tricky": the state word is
+   0 when unlocked, 1 when locked and 2 when locked with (possibly)
+   sleeping waiters, so unlock only makes a syscall when someone might
+   be asleep. Recursion is tracked with the owner thread id. The atomics
+   are the compiler's own, so the fast paths stay free of function calls.
+ */
+
+SDL_mutex *
+SDL_CreateMutex(void)
+{
+    SDL_mutex *mutex;
+
+    /* Allocate the structure */
+    mutex = (SDL_mutex *) SDL_calloc(1, sizeof(*mutex));
+    if (!mutex) {
+        SDL_OutOfMemory();
+    }
+    return (mutex);
+}
+
+void
+SDL_DestroyMutex(SDL_mutex * mutex)
+{
+    if (mutex) {
+        SDL_free(mutex);
+    }
+}
+
+SDL_FORCE_INLINE SDL_threadID
+GetThisThread(void)
+{
+    return (SDL_threadID) pthread_self();
+}
+
+/* Other threads write the owner while we read it, but it can only ever
+   match our own id if we stored it ourselves. */
+SDL_FORCE_INLINE SDL_threadID
+GetMutexOwner(SDL_mutex * mutex)
+{
+    return __atomic_load_n(&mutex->owner, __ATOMIC_RELAXED);
+}
+
+SDL_FORCE_INLINE void
+SetMutexOwner(SDL_mutex * mutex, SDL_threadID owner)
+{
+    __atomic_store_n(&mutex->owner, owner, __ATOMIC_RELAXED);
+}
+
+SDL_FORCE_INLINE SDL_bool
+TryAcquire(SDL_mutex * mutex)
+{
+    int unlocked = 0;
+    return __atomic_compare_exchange_n(&mutex->state.value, &unlocked, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Lock the mutex */
+int
+SDL_LockMutex(SDL_mutex * mutex)
+{
+    SDL_threadID this_thread;
+    SDL_bool locked;
+    int rounds, round;
+
+    if (mutex == NULL) {
+        return SDL_SetError("Passed a NULL mutex");
+    }
+
+    this_thread = GetThisThread();
+    if (GetMutexOwner(mutex) == this_thread) {
+        ++mutex->recursive;
+        return 0;
+    }
+
+    /* Uncontended, this is the only atomic operation */
+    locked = TryAcquire(mutex);
+
+    /* Spin for a little while in case the owner is about to let go, only
+       touching the cache line with a write once it looks free... */
+    rounds = SDL_FutexSpinRounds();
+    for (round = 0; !locked && round < rounds; ++round) {
+        SDL_FutexBackoff(round);
+        locked = (__atomic_load_n(&mutex->state.value, __ATOMIC_RELAXED) == 0 && TryAcquire(mutex));
+    }
+
+    /* ...then mark the mutex contended and sleep until it is released. */
+    if (!locked) {
+        while (__atomic_exchange_n(&mutex->state.value, 2, __ATOMIC_ACQUIRE) != 0) {
+            SDL_FutexWait(&mutex->state.value, 2, SDL_MUTEX_MAXWAIT);
+        }
+    }
+
+    SetMutexOwner(mutex, this_thread);
+    mutex->recursive = 0;
+    return 0;
+}
+
+int
+SDL_TryLockMutex(SDL_mutex * mutex)
+{
+    SDL_threadID this_thread;
+
+    if (mutex == NULL) {
+        return SDL_SetError("Passed a NULL mutex");
+    }
+
+    this_thread = GetThisThread();
+    if (GetMutexOwner(mutex) == this_thread) {
+        ++mutex->recursive;
+    } else if (TryAcquire(mutex)) {
+        SetMutexOwner(mutex, this_thread);
+        mutex->recursive = 0;
+    } else {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    return 0;
+}
+
+int
+SDL_UnlockMutex(SDL_mutex * mutex)
+{
+    if (mutex == NULL) {
+        return SDL_SetError("Passed a NULL mutex");
+    }
+
+    /* We can only unlock the mutex if we own it */
+    if (GetMutexOwner(mutex) != GetThisThread()) {
+        return SDL_SetError("mutex not owned by this thread");
+    }
+
+    if (mutex->recursive) {
+        --mutex->recursive;
+    } else {
+        /* Reset the owner before releasing the lock, so the next owner's
+           id can't be overwritten. Going from 1 to 0 means nobody slept. */
+        SetMutexOwner(mutex, 0);
+        if (__atomic_exchange_n(&mutex->state.value, 0, __ATOMIC_RELEASE) == 2) {
+            SDL_FutexWake(&mutex->state.value, 1);
+        }
+    }
+    return 0;
+}
+
+#else
 
 #if !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX && \
     !SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP
@@ -192,4 +340,6 @@ SDL_UnlockMutex(SDL_mutex * mutex)
     return 0;
 }
 
+#endif /* SDL_THREAD_PTHREAD_FUTEX */
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -23,10 +23,21 @@
 #ifndef SDL_mutex_c_h_
 #define SDL_mutex_c_h_
 
+#include "SDL_sysfutex_c.h"
+
+#if SDL_THREAD_PTHREAD_FUTEX
+struct SDL_mutex
+{
+    SDL_atomic_t state;     /* 0: unlocked, 1: locked, 2: locked and maybe contended */
+    SDL_threadID owner;
+    int recursive;
+};
+#else
 struct SDL_mutex
 {
     pthread_mutex_t id;
 };
+#endif
 
 #endif /* SDL_mutex_c_h_ */
 /* vi: set ts=4 sw=4 expandtab: */
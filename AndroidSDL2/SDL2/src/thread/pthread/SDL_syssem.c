@@ -28,14 +28,186 @@
 
 #include "SDL_thread.h"
 #include "SDL_timer.h"
+#include "SDL_sysfutex_c.h"
 
-/* Wrapper around POSIX 1003.1b semaphores */
+#if SDL_THREAD_PTHREAD_FUTEX
+
+/* Futex semaphore: the value and the number of waiters share one 64-bit
+   word, so a post is a single atomic add that also tells whether anybody
+   needs waking, and never touches the semaphore again afterwards (the
+   thread it releases may destroy it right away). A successful wait is a
+   single compare-and-swap. The low half, the value, is the futex word. */
+
+typedef union
+{
+    Uint64 state;
+    int words[2];
+} SDL_semstate;
+
+struct SDL_semaphore
+{
+    SDL_semstate u;
+};
+
+SDL_COMPILE_TIME_ASSERT(semstate, sizeof(int) * 2 == sizeof(Uint64));
+
+#define SEM_WAITER          ((Uint64) 1 << 32)
+#define SEM_VALUE(state)    ((Uint32) (state))
+#define SEM_WAITERS(state)  ((Uint32) ((state) >> 32))
+
+/* Whichever half of the state holds its low 32 bits on this CPU; the
+   compiler folds the test to a constant. */
+static int *
+SDL_SemFutexWord(SDL_sem * sem)
+{
+    static const SDL_semstate one = { 1 };
+    return &sem->u.words[one.words[0] ? 0 : 1];
+}
+
+/* Create a semaphore, initialized with value */
+SDL_sem *
+SDL_CreateSemaphore(Uint32 initial_value)
+{
+    SDL_sem *sem = (SDL_sem *) SDL_malloc(sizeof(SDL_sem));
+    if (sem) {
+        sem->u.state = initial_value;
+    } else {
+        SDL_OutOfMemory();
+    }
+    return sem;
+}
+
+void
+SDL_DestroySemaphore(SDL_sem * sem)
+{
+    if (sem) {
+        SDL_free(sem);
+    }
+}
+
+static SDL_bool
+SDL_SemTryDecrement(SDL_sem * sem)
+{
+    Uint64 state = __atomic_load_n(&sem->u.state, __ATOMIC_RELAXED);
+
+    while (SEM_VALUE(state) > 0) {
+        if (__atomic_compare_exchange_n(&sem->u.state, &state, state - 1, 1, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+int
+SDL_SemTryWait(SDL_sem * sem)
+{
+    if (!sem) {
+        return SDL_SetError("Passed a NULL semaphore");
+    }
+    return SDL_SemTryDecrement(sem) ? 0 : SDL_MUTEX_TIMEDOUT;
+}
 
-#if defined(__MACOSX__) || defined(__IPHONEOS__)
+int
+SDL_SemWait(SDL_sem * sem)
+{
+    return SDL_SemWaitTimeout(sem, SDL_MUTEX_MAXWAIT);
+}
+
+int
+SDL_SemWaitTimeout(SDL_sem * sem, Uint32 timeout)
+{
+    int rounds, round;
+    Uint64 state;
+    Uint32 end = 0;
+    Uint32 now;
+    SDL_bool timedout = SDL_FALSE;
+
+    if (!sem) {
+        return SDL_SetError("Passed a NULL semaphore");
+    }
+
+    /* Try the easy cases first */
+    if (SDL_SemTryDecrement(sem)) {
+        return 0;
+    }
+    if (timeout == 0) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+
+    /* A post may be just around the corner */
+    rounds = SDL_FutexSpinRounds();
+    for (round = 0; round < rounds; ++round) {
+        SDL_FutexBackoff(round);
+        if (SDL_SemTryDecrement(sem)) {
+            return 0;
+        }
+    }
+
+    if (timeout != SDL_MUTEX_MAXWAIT) {
+        end = SDL_GetTicks() + timeout;
+    }
+
+    /* Register as a waiter, then take a unit or sleep until one is
+       posted. Leaving, with or without a unit, unregisters in the same
+       atomic operation, and giving up is only allowed while the value
+       is 0, so a wakeup is never left behind for nobody. */
+    state = __atomic_add_fetch(&sem->u.state, SEM_WAITER, __ATOMIC_RELAXED);
+    for (;;) {
+        if (SEM_VALUE(state) > 0) {
+            if (__atomic_compare_exchange_n(&sem->u.state, &state, state - 1 - SEM_WAITER, 1, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                return 0;
+            }
+            continue;
+        }
+        if (timedout) {
+            if (__atomic_compare_exchange_n(&sem->u.state, &state, state - SEM_WAITER, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                return SDL_MUTEX_TIMEDOUT;
+            }
+            continue;
+        }
+        if (timeout != SDL_MUTEX_MAXWAIT) {
+            now = SDL_GetTicks();
+            if (SDL_TICKS_PASSED(now, end)) {
+                timedout = SDL_TRUE;
+                continue;
+            }
+            timeout = end - now;
+        }
+        SDL_FutexWait(SDL_SemFutexWord(sem), 0, timeout);
+        state = __atomic_load_n(&sem->u.state, __ATOMIC_RELAXED);
+    }
+}
+
+Uint32
+SDL_SemValue(SDL_sem * sem)
+{
+    Uint32 ret = 0;
+    if (sem) {
+        ret = SEM_VALUE(__atomic_load_n(&sem->u.state, __ATOMIC_RELAXED));
+    }
+    return ret;
+}
+
+int
+SDL_SemPost(SDL_sem * sem)
+{
+    if (!sem) {
+        return SDL_SetError("Passed a NULL semaphore");
+    }
+
+    if (SEM_WAITERS(__atomic_fetch_add(&sem->u.state, 1, __ATOMIC_RELEASE)) > 0) {
+        SDL_FutexWake(SDL_SemFutexWord(sem), 1);
+    }
+    return 0;
+}
+
+#elif defined(__MACOSX__) || defined(__IPHONEOS__)
 /* Mac OS X doesn't support sem_getvalue() as of version 10.4 */
 #include "../generic/SDL_syssem.c"
 #else
 
+/* Wrapper around POSIX 1003.1b semaphores */
+
 struct SDL_semaphore
 {
     sem_t sem;
@@ -205,5 +377,5 @@ SDL_SemPost(SDL_sem * sem)
     return retval;
 }
 
-#endif /* __MACOSX__ */
+#endif /* SDL_THREAD_PTHREAD_FUTEX */
 /* vi: set ts=4 sw=4 expandtab: */
@@ -34,24 +34,21 @@ typedef struct _SDL_Timer
     SDL_TimerCallback callback;
     void *param;
     Uint32 interval;
-    Uint32 scheduled;
+    Uint64 scheduled;           /* performance counter value it's due at */
     SDL_atomic_t canceled;
-    struct _SDL_Timer *next;
+    struct _SDL_Timer *next;    /* pending list or freelist */
+    struct _SDL_Timer *map_next;/* hash chain of timers with an ID */
+    SDL_bool mapped;
 } SDL_Timer;
 
-typedef struct _SDL_TimerMap
-{
-    int timerID;
-    SDL_Timer *timer;
-    struct _SDL_TimerMap *next;
-} SDL_TimerMap;
-
-/* The timers are kept in a sorted list */
+/* The timers are kept in a binary heap, ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_Timer **timermap;
+    int timermap_mask;
+    int timermap_count;
     SDL_mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -63,9 +60,13 @@ typedef struct {
     SDL_Timer *pending;
     SDL_Timer *freelist;
     SDL_atomic_t active;
+    SDL_atomic_t num_canceled;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 frequency;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -73,28 +74,111 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by simply setting a canceled flag, and are dropped
+ * from the queue when they come due, or in one pass once canceled timers
+ * make up half of the queue.
  */
 
+static SDL_INLINE Uint64
+SDL_TimerTicks(SDL_TimerData *data, Uint32 interval)
+{
+    return (interval * data->frequency) / 1000;
+}
+
 static void
-SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+SDL_SiftTimerUp(SDL_TimerData *data, int i)
 {
-    SDL_Timer *prev, *curr;
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (timers[parent]->scheduled <= timer->scheduled) {
             break;
         }
+        timers[i] = timers[parent];
+        i = parent;
     }
+    timers[i] = timer;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static void
+SDL_SiftTimerDown(SDL_TimerData *data, int i)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
+    const int count = data->num_timers;
+
+    for ( ; ; ) {
+        int child = 2 * i + 1;
+        if (child >= count) {
+            break;
+        }
+        if ((child + 1) < count && timers[child + 1]->scheduled < timers[child]->scheduled) {
+            ++child;
+        }
+        if (timer->scheduled <= timers[child]->scheduled) {
+            break;
+        }
+        timers[i] = timers[child];
+        i = child;
     }
-    timer->next = curr;
+    timers[i] = timer;
+}
+
+static SDL_bool
+SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return SDL_FALSE;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    data->timers[data->num_timers] = timer;
+    SDL_SiftTimerUp(data, data->num_timers++);
+    return SDL_TRUE;
+}
+
+static SDL_Timer *
+SDL_PopTimerInternal(SDL_TimerData *data)
+{
+    SDL_Timer *timer = data->timers[0];
+
+    if (--data->num_timers > 0) {
+        data->timers[0] = data->timers[data->num_timers];
+        SDL_SiftTimerDown(data, 0);
+    }
+    return timer;
+}
+
+/* Take the canceled timers out of the heap, returning them as a list */
+static SDL_Timer *
+SDL_PruneTimersInternal(SDL_TimerData *data)
+{
+    SDL_Timer *canceled = NULL;
+    int i, count = 0;
+
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_Timer *timer = data->timers[i];
+        if (SDL_AtomicGet(&timer->canceled)) {
+            timer->next = canceled;
+            canceled = timer;
+        } else {
+            data->timers[count++] = timer;
+        }
+    }
+    SDL_AtomicAdd(&data->num_canceled, count - data->num_timers);
+    data->num_timers = count;
+
+    for (i = (count / 2) - 1; i >= 0; --i) {
+        SDL_SiftTimerDown(data, i);
+    }
+    return canceled;
 }
 
 static int SDLCALL
@@ -105,7 +189,8 @@ SDL_TimerThread(void *_data)
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, next;
+    Uint32 interval, delay;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -127,50 +212,80 @@ SDL_TimerThread(void *_data)
             }
         }
         SDL_AtomicUnlock(&data->lock);
+        freelist_head = NULL;
+        freelist_tail = NULL;
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
+            if (!SDL_AddTimerInternal(data, current)) {
+                break;
+            }
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
+        if (pending) {
+            /* Out of memory, try again on the next cycle */
+            SDL_AtomicLock(&data->lock);
+            for (current = pending; current->next; current = current->next) {
+                continue;
+            }
+            current->next = data->pending;
+            data->pending = pending;
+            SDL_AtomicUnlock(&data->lock);
+        }
 
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
             break;
         }
 
+        /* Drop canceled timers in one go if they've piled up */
+        if (SDL_AtomicGet(&data->num_canceled) > (data->num_timers / 2) + 64) {
+            freelist_head = SDL_PruneTimersInternal(data);
+            for (current = freelist_head; current; current = current->next) {
+                freelist_tail = current;
+            }
+        }
+
         /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
+        delay = pending ? 1 : SDL_MUTEX_MAXWAIT;
 
-        tick = SDL_GetTicks();
+        tick = SDL_GetPerformanceCounter();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
-
-            if ((Sint32)(tick-current->scheduled) < 0) {
-                /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+        while (data->num_timers > 0) {
+            current = data->timers[0];
+
+            if (current->scheduled > tick) {
+                /* Scheduled for the future, wait a bit. Round up, as waking
+                   early would only mean spinning until it's due. */
+                const Uint64 ms = ((current->scheduled - tick) * 1000 + data->frequency - 1) / data->frequency;
+                delay = (Uint32)SDL_min(ms, (Uint64)delay);
                 break;
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            SDL_PopTimerInternal(data);
 
             if (SDL_AtomicGet(&current->canceled)) {
+                /* SDL_RemoveTimer counted it, and it's no longer in the heap */
+                SDL_AtomicAdd(&data->num_canceled, -1);
                 interval = 0;
             } else {
                 interval = current->callback(current->interval, current->param);
             }
 
             if (interval > 0) {
-                /* Reschedule this timer */
+                /* Reschedule this timer, relative to when it was due so
+                   periodic timers don't drift */
                 current->interval = interval;
-                current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
+                next = current->scheduled + SDL_TimerTicks(data, interval);
+                if (next <= tick) {
+                    /* We fell more than a whole interval behind, don't try to catch up */
+                    next = tick + SDL_TimerTicks(data, interval);
+                }
+                current->scheduled = next;
+                SDL_AddTimerInternal(data, current);  /* it was just popped, so there's room */
             } else {
                 if (!freelist_head) {
                     freelist_head = current;
@@ -179,17 +294,24 @@ SDL_TimerThread(void *_data)
                     freelist_tail->next = current;
                 }
                 freelist_tail = current;
+                current->next = NULL;
 
-                SDL_AtomicSet(&current->canceled, 1);
+                if (SDL_AtomicSet(&current->canceled, 1)) {
+                    /* Removed while its callback ran, after being counted */
+                    SDL_AtomicAdd(&data->num_canceled, -1);
+                }
             }
         }
 
+        if (freelist_tail) {
+            freelist_tail->next = NULL;
+        }
+
         /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
+        interval = (Uint32)(((SDL_GetPerformanceCounter() - tick) * 1000) / data->frequency);
         if (interval > delay) {
             delay = 0;
-        } else {
+        } else if (delay != SDL_MUTEX_MAXWAIT) {
             delay -= interval;
         }
 
@@ -221,6 +343,8 @@ SDL_TimerInit(void)
             return -1;
         }
 
+        data->frequency = SDL_GetPerformanceFrequency();
+        SDL_AtomicSet(&data->num_canceled, 0);
         SDL_AtomicSet(&data->active, 1);
 
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
@@ -240,7 +364,7 @@ SDL_TimerQuit(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) {  /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -254,9 +378,16 @@ SDL_TimerQuit(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
+        for (i = 0; i < data->num_timers; ++i) {
+            SDL_free(data->timers[i]);
+        }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_timers = 0;
+        data->max_timers = 0;
+        while (data->pending) {
+            timer = data->pending;
+            data->pending = timer->next;
             SDL_free(timer);
         }
         while (data->freelist) {
@@ -264,23 +395,81 @@ SDL_TimerQuit(void)
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
-        }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_mask = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
+/* Look up a timer by ID, removing it from the map -- called with the map locked */
+static SDL_Timer *
+SDL_UnmapTimer(SDL_TimerData *data, SDL_TimerID id)
+{
+    SDL_Timer **link;
+
+    if (!data->timermap) {
+        return NULL;
+    }
+
+    for (link = &data->timermap[id & data->timermap_mask]; *link; link = &(*link)->map_next) {
+        SDL_Timer *timer = *link;
+        if (timer->timerID == id) {
+            *link = timer->map_next;
+            timer->mapped = SDL_FALSE;
+            --data->timermap_count;
+            return timer;
+        }
+    }
+    return NULL;
+}
+
+/* Add a timer to the map, growing it as needed -- called with the map locked */
+static SDL_bool
+SDL_MapTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_Timer **bucket;
+
+    if (!data->timermap || data->timermap_count > data->timermap_mask) {
+        const int size = data->timermap ? ((data->timermap_mask + 1) * 2) : 64;
+        SDL_Timer **timermap = (SDL_Timer **)SDL_calloc(size, sizeof(*timermap));
+        int i;
+
+        if (!timermap) {
+            return SDL_FALSE;
+        }
+        if (data->timermap) {
+            for (i = 0; i <= data->timermap_mask; ++i) {
+                SDL_Timer *entry = data->timermap[i];
+                while (entry) {
+                    SDL_Timer *next = entry->map_next;
+                    entry->map_next = timermap[entry->timerID & (size - 1)];
+                    timermap[entry->timerID & (size - 1)] = entry;
+                    entry = next;
+                }
+            }
+            SDL_free(data->timermap);
+        }
+        data->timermap = timermap;
+        data->timermap_mask = size - 1;
+    }
+
+    bucket = &data->timermap[timer->timerID & data->timermap_mask];
+    timer->map_next = *bucket;
+    *bucket = timer;
+    timer->mapped = SDL_TRUE;
+    ++data->timermap_count;
+    return SDL_TRUE;
+}
+
 SDL_TimerID
 SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
 
     SDL_AtomicLock(&data->lock);
     if (!SDL_AtomicGet(&data->active)) {
@@ -296,34 +485,34 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     }
     SDL_AtomicUnlock(&data->lock);
 
+    SDL_LockMutex(data->timermap_lock);
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        /* The old ID stays valid until the structure is reused */
+        if (timer->mapped) {
+            SDL_UnmapTimer(data, timer->timerID);
+        }
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
+            SDL_UnlockMutex(data->timermap_lock);
             SDL_OutOfMemory();
             return 0;
         }
+        timer->mapped = SDL_FALSE;
     }
     timer->timerID = SDL_AtomicIncRef(&data->nextID);
     timer->callback = callback;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_GetPerformanceCounter() + SDL_TimerTicks(data, interval);
     SDL_AtomicSet(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    if (!SDL_MapTimer(data, timer)) {
+        SDL_UnlockMutex(data->timermap_lock);
         SDL_free(timer);
         SDL_OutOfMemory();
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
     SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -335,38 +524,27 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     /* Wake up the timer thread if necessary */
     SDL_SemPost(data->sem);
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
+    timer = SDL_UnmapTimer(data, id);
+    if (timer) {
+        if (SDL_AtomicCAS(&timer->canceled, 0, 1)) {
+            SDL_AtomicAdd(&data->num_canceled, 1);
+            canceled = SDL_TRUE;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!SDL_AtomicGet(&entry->timer->canceled)) {
-            SDL_AtomicSet(&entry->timer->canceled, 1);
-            canceled = SDL_TRUE;
-        }
-        SDL_free(entry);
-    }
     return canceled;
 }
 
@@ -28,6 +28,7 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 /* The general purpose software blit routine */
 static int SDLCALL
@@ -143,19 +144,23 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
         if (override) {
             SDL_sscanf(override, "%u", &features);
         } else {
-            if (SDL_HasMMX()) {
+            const Uint32 isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_AUTO);
+            if (isas & CPU_HAS_MMX) {
                 features |= SDL_CPU_MMX;
             }
-            if (SDL_Has3DNow()) {
+            if (isas & CPU_HAS_3DNOW) {
                 features |= SDL_CPU_3DNOW;
             }
-            if (SDL_HasSSE()) {
+            if (isas & CPU_HAS_SSE) {
                 features |= SDL_CPU_SSE;
             }
-            if (SDL_HasSSE2()) {
+            if (isas & CPU_HAS_SSE2) {
                 features |= SDL_CPU_SSE2;
             }
-            if (SDL_HasAltiVec()) {
+            if (isas & CPU_HAS_AVX2) {
+                features |= SDL_CPU_AVX2;
+            }
+            if (isas & CPU_HAS_ALTIVEC) {
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
                 } else {
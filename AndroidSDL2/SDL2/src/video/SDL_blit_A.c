@@ -24,6 +24,7 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 /* Functions to perform alpha blended blitting */
 
@@ -391,6 +392,360 @@ BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo * info)
 
 #endif /* __MMX__ */
 
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+/* The blitters below give the same results as the MMX ones above: with
+   pixel alpha, each channel is (s * A >> 8) + (d * (255 - A) >> 8), where the
+   source alpha channel is multiplied by 255 instead, and fully transparent
+   or opaque pixels are skipped or copied. With surface alpha, each color
+   channel is d + ((s - d) * alpha >> 8) and the destination alpha is set.
+   Rows are blended a whole vector at a time; the last few pixels of a row go
+   through a small buffer so that nothing past the end of the row is touched.
+ */
+
+/* Shuffle that copies the 16-bit alpha lane of two unpacked pixels over all their lanes */
+#define ALPHA_SPREAD_LANES(alane) \
+    (char)(2 * (alane)), -128, (char)(2 * (alane)), -128, (char)(2 * (alane)), -128, (char)(2 * (alane)), -128, \
+    (char)(8 + 2 * (alane)), -128, (char)(8 + 2 * (alane)), -128, (char)(8 + 2 * (alane)), -128, (char)(8 + 2 * (alane)), -128
+#endif
+
+#if SDL_SSE4_1_INTRINSICS
+
+/* Blends two unpacked pixels with their own alpha */
+#define PIXEL_ALPHA_SSE41(s16, d16) \
+    _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16((s16), _mm_or_si128(_mm_shuffle_epi8((s16), spread), alphalane)), 8), \
+                  _mm_srli_epi16(_mm_mullo_epi16((d16), _mm_xor_si128(_mm_shuffle_epi8((s16), spread), ff)), 8))
+
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBPixelAlphaSSE41_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 amask, int alane)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i amask128 = _mm_set1_epi32(amask);
+    const __m128i alphalane = _mm_unpacklo_epi8(amask128, zero);
+    const __m128i spread = _mm_setr_epi8(ALPHA_SPREAD_LANES(alane));
+
+    for (; n > 0; n -= 4, srcp += 4, dstp += 4) {
+        Uint32 sbuf[4], dbuf[4];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m128i s, d, a, transparent, opaque, out;
+
+        if (n < 4) {
+            SDL_zeroa(sbuf);  /* zero alpha leaves the padding alone */
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm_loadu_si128((const __m128i *) sp);
+        a = _mm_and_si128(s, amask128);
+        transparent = _mm_cmpeq_epi32(a, zero);
+        opaque = _mm_cmpeq_epi32(a, amask128);
+        if (_mm_movemask_epi8(transparent) == 0xFFFF) {
+            continue;
+        }
+        if (_mm_movemask_epi8(opaque) == 0xFFFF) {
+            out = s;
+        } else {
+            d = _mm_loadu_si128((const __m128i *) dp);
+            out = _mm_packus_epi16(PIXEL_ALPHA_SSE41(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero)),
+                                   PIXEL_ALPHA_SSE41(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero)));
+            out = _mm_blendv_epi8(out, s, opaque);
+            out = _mm_blendv_epi8(out, d, transparent);
+        }
+        _mm_storeu_si128((__m128i *) dp, out);
+
+        if (n < 4) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+
+    while (height--) {
+        BlitRGBtoRGBPixelAlphaSSE41_Span(srcp, dstp, width, sf->Amask, sf->Ashift / 8);
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBSurfaceAlphaSSE41_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 chanalpha, Uint32 dalpha)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dsta = _mm_set1_epi32(dalpha);
+    const __m128i alpha16 = _mm_unpacklo_epi8(_mm_set1_epi32(chanalpha), zero);
+
+    for (; n > 0; n -= 4, srcp += 4, dstp += 4) {
+        Uint32 sbuf[4], dbuf[4];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m128i s, d, lo, hi;
+
+        if (n < 4) {
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm_loadu_si128((const __m128i *) sp);
+        d = _mm_loadu_si128((const __m128i *) dp);
+        /* the byte-wise add wraps like the MMX version, and the high byte of each lane stays zero */
+        lo = _mm_unpacklo_epi8(d, zero);
+        lo = _mm_add_epi8(_mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(s, zero), lo), alpha16), 8), lo);
+        hi = _mm_unpackhi_epi8(d, zero);
+        hi = _mm_add_epi8(_mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(s, zero), hi), alpha16), 8), hi);
+        _mm_storeu_si128((__m128i *) dp, _mm_or_si128(_mm_packus_epi16(lo, hi), dsta));
+
+        if (n < 4) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+/* Alpha 128 is a plain average of the color channels, rounded down */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBSurfaceAlpha128SSE41_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 dalpha)
+{
+    const __m128i lmask = _mm_set1_epi32(0x00010101);
+    const __m128i chanmask = _mm_set1_epi32(0x00ffffff);
+    const __m128i dsta = _mm_set1_epi32(dalpha);
+
+    for (; n > 0; n -= 4, srcp += 4, dstp += 4) {
+        Uint32 sbuf[4], dbuf[4];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m128i s, d, out;
+
+        if (n < 4) {
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm_loadu_si128((const __m128i *) sp);
+        d = _mm_loadu_si128((const __m128i *) dp);
+        out = _mm_sub_epi8(_mm_avg_epu8(s, d), _mm_and_si128(_mm_xor_si128(s, d), lmask));
+        _mm_storeu_si128((__m128i *) dp, _mm_or_si128(_mm_and_si128(out, chanmask), dsta));
+
+        if (n < 4) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+    const Uint32 amult = info->a * 0x01010101;
+    /* only use the a128 version when R,G,B occupy lower bits, like the MMX blitter */
+    const SDL_bool a128 = (info->a == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF);
+
+    while (height--) {
+        if (a128) {
+            BlitRGBtoRGBSurfaceAlpha128SSE41_Span(srcp, dstp, width, df->Amask);
+        } else {
+            BlitRGBtoRGBSurfaceAlphaSSE41_Span(srcp, dstp, width, amult & chanmask, df->Amask);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+#undef PIXEL_ALPHA_SSE41
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+
+/* Blends four unpacked pixels, two in each 128-bit lane, with their own alpha */
+#define PIXEL_ALPHA_AVX2(s16, d16) \
+    _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16((s16), _mm256_or_si256(_mm256_shuffle_epi8((s16), spread), alphalane)), 8), \
+                     _mm256_srli_epi16(_mm256_mullo_epi16((d16), _mm256_xor_si256(_mm256_shuffle_epi8((s16), spread), ff)), 8))
+
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBPixelAlphaAVX2_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 amask, int alane)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ff = _mm256_set1_epi16(0xFF);
+    const __m256i amask256 = _mm256_set1_epi32(amask);
+    const __m256i alphalane = _mm256_unpacklo_epi8(amask256, zero);
+    const __m256i spread = _mm256_setr_epi8(ALPHA_SPREAD_LANES(alane), ALPHA_SPREAD_LANES(alane));
+
+    for (; n > 0; n -= 8, srcp += 8, dstp += 8) {
+        Uint32 sbuf[8], dbuf[8];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m256i s, d, a, transparent, opaque, out;
+
+        if (n < 8) {
+            SDL_zeroa(sbuf);  /* zero alpha leaves the padding alone */
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm256_loadu_si256((const __m256i *) sp);
+        a = _mm256_and_si256(s, amask256);
+        transparent = _mm256_cmpeq_epi32(a, zero);
+        opaque = _mm256_cmpeq_epi32(a, amask256);
+        if (_mm256_movemask_epi8(transparent) == -1) {
+            continue;
+        }
+        if (_mm256_movemask_epi8(opaque) == -1) {
+            out = s;
+        } else {
+            d = _mm256_loadu_si256((const __m256i *) dp);
+            out = _mm256_packus_epi16(PIXEL_ALPHA_AVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero)),
+                                      PIXEL_ALPHA_AVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero)));
+            out = _mm256_blendv_epi8(out, s, opaque);
+            out = _mm256_blendv_epi8(out, d, transparent);
+        }
+        _mm256_storeu_si256((__m256i *) dp, out);
+
+        if (n < 8) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+
+    while (height--) {
+        BlitRGBtoRGBPixelAlphaAVX2_Span(srcp, dstp, width, sf->Amask, sf->Ashift / 8);
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlphaAVX2_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 chanalpha, Uint32 dalpha)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i dsta = _mm256_set1_epi32(dalpha);
+    const __m256i alpha16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(chanalpha), zero);
+
+    for (; n > 0; n -= 8, srcp += 8, dstp += 8) {
+        Uint32 sbuf[8], dbuf[8];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m256i s, d, lo, hi;
+
+        if (n < 8) {
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm256_loadu_si256((const __m256i *) sp);
+        d = _mm256_loadu_si256((const __m256i *) dp);
+        lo = _mm256_unpacklo_epi8(d, zero);
+        lo = _mm256_add_epi8(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero), lo), alpha16), 8), lo);
+        hi = _mm256_unpackhi_epi8(d, zero);
+        hi = _mm256_add_epi8(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero), hi), alpha16), 8), hi);
+        _mm256_storeu_si256((__m256i *) dp, _mm256_or_si256(_mm256_packus_epi16(lo, hi), dsta));
+
+        if (n < 8) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlpha128AVX2_Span(const Uint32 * srcp, Uint32 * dstp, int n, Uint32 dalpha)
+{
+    const __m256i lmask = _mm256_set1_epi32(0x00010101);
+    const __m256i chanmask = _mm256_set1_epi32(0x00ffffff);
+    const __m256i dsta = _mm256_set1_epi32(dalpha);
+
+    for (; n > 0; n -= 8, srcp += 8, dstp += 8) {
+        Uint32 sbuf[8], dbuf[8];
+        const Uint32 *sp = srcp;
+        Uint32 *dp = dstp;
+        __m256i s, d, out;
+
+        if (n < 8) {
+            SDL_memcpy(sbuf, srcp, n * sizeof (Uint32));
+            SDL_memcpy(dbuf, dstp, n * sizeof (Uint32));
+            sp = sbuf;
+            dp = dbuf;
+        }
+
+        s = _mm256_loadu_si256((const __m256i *) sp);
+        d = _mm256_loadu_si256((const __m256i *) dp);
+        out = _mm256_sub_epi8(_mm256_avg_epu8(s, d), _mm256_and_si256(_mm256_xor_si256(s, d), lmask));
+        _mm256_storeu_si256((__m256i *) dp, _mm256_or_si256(_mm256_and_si256(out, chanmask), dsta));
+
+        if (n < 8) {
+            SDL_memcpy(dstp, dbuf, n * sizeof (Uint32));
+        }
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const Uint32 chanmask = (0xff << df->Rshift) | (0xff << df->Gshift) | (0xff << df->Bshift);
+    const Uint32 amult = info->a * 0x01010101;
+    /* only use the a128 version when R,G,B occupy lower bits, like the MMX blitter */
+    const SDL_bool a128 = (info->a == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF);
+
+    while (height--) {
+        if (a128) {
+            BlitRGBtoRGBSurfaceAlpha128AVX2_Span(srcp, dstp, width, df->Amask);
+        } else {
+            BlitRGBtoRGBSurfaceAlphaAVX2_Span(srcp, dstp, width, amult & chanmask, df->Amask);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+#undef PIXEL_ALPHA_AVX2
+#endif /* SDL_AVX2_INTRINSICS */
+
 #if SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
 
@@ -1357,11 +1712,11 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     || (sf->Bmask == 0xff && df->Bmask == 0x1f)))
                 {
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_NEON))
                         return BlitARGBto565PixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-                    if (SDL_HasARMSIMD())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_ARM_SIMD))
                         return BlitARGBto565PixelAlphaARMSIMD;
 #endif
                 }
@@ -1381,28 +1736,43 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+                if (sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0
+                    && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+#if SDL_AVX2_INTRINSICS
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_AVX2))
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if SDL_SSE4_1_INTRINSICS
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_SSE41))
+                        return BlitRGBtoRGBPixelAlphaSSE41;
+#endif
+                }
+#endif
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
-                    if (SDL_Has3DNow())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_3DNOW))
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
 #endif
 #ifdef __MMX__
-                    if (SDL_HasMMX())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_MMX))
                         return BlitRGBtoRGBPixelAlphaMMX;
 #endif
                 }
 #endif /* __MMX__ || __3dNOW__ */
                 if (sf->Amask == 0xff000000) {
 #if SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_NEON))
                         return BlitRGBtoRGBPixelAlphaARMNEON;
 #endif
 #if SDL_ARM_SIMD_BLITTERS
-                    if (SDL_HasARMSIMD())
+                    if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_ARM_SIMD))
                         return BlitRGBtoRGBPixelAlphaARMSIMD;
 #endif
                     return BlitRGBtoRGBPixelAlpha;
@@ -1432,14 +1802,14 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_MMX))
                             return Blit565to565SurfaceAlphaMMX;
                         else
 #endif
                             return Blit565to565SurfaceAlpha;
                     } else if (df->Gmask == 0x3e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_MMX))
                             return Blit555to555SurfaceAlphaMMX;
                         else
 #endif
@@ -1452,10 +1822,25 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+                    if (sf->Rshift % 8 == 0
+                        && sf->Gshift % 8 == 0
+                        && sf->Bshift % 8 == 0) {
+#if SDL_AVX2_INTRINSICS
+                        if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_AVX2))
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if SDL_SSE4_1_INTRINSICS
+                        if ((SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_SSE41))
+                            return BlitRGBtoRGBSurfaceAlphaSSE41;
+#endif
+                    }
+#endif
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
-                        && sf->Bshift % 8 == 0 && SDL_HasMMX())
+                        && sf->Bshift % 8 == 0
+                        && (SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_ALPHA) & CPU_HAS_MMX))
                         return BlitRGBtoRGBSurfaceAlphaMMX;
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
@@ -26,6 +26,7 @@
 #include "SDL_endian.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_blit.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 #include "SDL_assert.h"
 
@@ -45,7 +46,9 @@ enum blit_features {
 	BLIT_FEATURE_HAS_MMX = 1,
 	BLIT_FEATURE_HAS_ALTIVEC = 2,
 	BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH = 4,
-	BLIT_FEATURE_HAS_ARM_SIMD = 8
+	BLIT_FEATURE_HAS_ARM_SIMD = 8,
+	BLIT_FEATURE_HAS_SSE41 = 16,
+	BLIT_FEATURE_HAS_AVX2 = 32
 };
 
 #if SDL_ALTIVEC_BLITTERS
@@ -916,14 +919,17 @@ GetBlitFeatures(void)
             SDL_sscanf(override, "%u", &features_as_uint);
             features = (enum blit_features) features_as_uint;
         } else {
+            const Uint32 isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_CONVERT);
             features = (0
                         /* Feature 1 is has-MMX */
-                        | ((SDL_HasMMX())? BLIT_FEATURE_HAS_MMX : 0)
+                        | ((isas & CPU_HAS_MMX)? BLIT_FEATURE_HAS_MMX : 0)
                         /* Feature 2 is has-AltiVec */
-                        | ((SDL_HasAltiVec())? BLIT_FEATURE_HAS_ALTIVEC : 0)
+                        | ((isas & CPU_HAS_ALTIVEC)? BLIT_FEATURE_HAS_ALTIVEC : 0)
                         /* Feature 4 is dont-use-prefetch */
                         /* !!!! FIXME: Check for G5 or later, not the cache size! Always prefetch on a G4. */
                         | ((GetL3CacheSize() == 0) ? BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH : 0)
+                        | ((isas & CPU_HAS_SSE41)? BLIT_FEATURE_HAS_SSE41 : 0)
+                        | ((isas & CPU_HAS_AVX2)? BLIT_FEATURE_HAS_AVX2 : 0)
                 );
         }
     }
@@ -934,8 +940,16 @@ GetBlitFeatures(void)
 #pragma altivec_model off
 #endif
 #else
-/* Feature 1 is has-MMX */
-#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0))
+static enum blit_features
+GetBlitFeatures(void)
+{
+    const Uint32 isas = SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_CONVERT);
+    /* Feature 1 is has-MMX */
+    return (enum blit_features) (((isas & CPU_HAS_MMX) ? BLIT_FEATURE_HAS_MMX : 0) |
+                                 ((isas & CPU_HAS_ARM_SIMD) ? BLIT_FEATURE_HAS_ARM_SIMD : 0) |
+                                 ((isas & CPU_HAS_SSE41) ? BLIT_FEATURE_HAS_SSE41 : 0) |
+                                 ((isas & CPU_HAS_AVX2) ? BLIT_FEATURE_HAS_AVX2 : 0));
+}
 #endif
 
 #if SDL_ARM_SIMD_BLITTERS
@@ -3220,6 +3234,424 @@ Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo * info)
     }
 }
 
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+/* Byte shuffle blitters for 24 and 32-bit formats with 8-bit channels.
+   They write exactly what the C blitters they stand in for would, down to
+   the unused byte of formats without alpha. Only x86 has these, so they
+   can assume a little endian byte order.
+ */
+struct swizzle
+{
+    Uint8 pattern[4];   /* source byte for each destination byte, 0x80 for none */
+    Uint32 andmask;
+    Uint32 ormask;
+    Uint32 keepmask;    /* destination bits that are left alone */
+    Uint32 ckey;
+    Uint32 ckeymask;
+};
+
+static SDL_bool
+SwizzleSupported(const SDL_PixelFormat * fmt)
+{
+    if (fmt->BytesPerPixel != 3 && fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    if (fmt->Rloss || fmt->Gloss || fmt->Bloss || (fmt->Amask && fmt->Aloss)) {
+        return SDL_FALSE;
+    }
+    return ((fmt->Rshift | fmt->Gshift | fmt->Bshift | fmt->Ashift) & 7) == 0;
+}
+
+static SDL_bool
+IsInversedRGB(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+    return (srcfmt->Rmask == 0x000000FF && srcfmt->Gmask == 0x0000FF00 && srcfmt->Bmask == 0x00FF0000 &&
+            dstfmt->Rmask == 0x00FF0000 && dstfmt->Gmask == 0x0000FF00 && dstfmt->Bmask == 0x000000FF) ||
+           (srcfmt->Rmask == 0x00FF0000 && srcfmt->Gmask == 0x0000FF00 && srcfmt->Bmask == 0x000000FF &&
+            dstfmt->Rmask == 0x000000FF && dstfmt->Gmask == 0x0000FF00 && dstfmt->Bmask == 0x00FF0000);
+}
+
+/* Works out the shuffle that matches the C blitter SDL_CalculateBlitN would pick */
+static void
+get_swizzle(const SDL_BlitInfo * info, SDL_bool keyed, struct swizzle *sw)
+{
+    SDL_PixelFormat *srcfmt = info->src_fmt;
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+    int srcbpp = srcfmt->BytesPerPixel;
+    int dstbpp = dstfmt->BytesPerPixel;
+    SDL_bool same_rgb = (srcfmt->Rmask == dstfmt->Rmask &&
+                         srcfmt->Gmask == dstfmt->Gmask &&
+                         srcfmt->Bmask == dstfmt->Bmask);
+    int alpha_channel, p0, p1, p2, p3;
+
+    get_permutation(srcfmt, dstfmt, &p0, &p1, &p2, &p3, &alpha_channel);
+    sw->pattern[0] = (Uint8) p0;
+    sw->pattern[1] = (Uint8) p1;
+    sw->pattern[2] = (Uint8) p2;
+    sw->pattern[3] = (Uint8) p3;
+    sw->andmask = 0xFFFFFFFF;
+    sw->ormask = 0;
+    sw->keepmask = 0;
+    sw->ckeymask = ~srcfmt->Amask;
+    sw->ckey = info->colorkey & sw->ckeymask;
+
+    if (dstbpp == 3) {
+        sw->pattern[3] = 0x80;
+    } else if (srcbpp == 4 && same_rgb && !(srcfmt->Amask && dstfmt->Amask)) {
+        /* Blit4to4MaskAlpha and BlitNtoNKey keep the whole source pixel */
+        sw->pattern[0] = 0;
+        sw->pattern[1] = 1;
+        sw->pattern[2] = 2;
+        sw->pattern[3] = 3;
+        if (dstfmt->Amask) {
+            sw->ormask = (Uint32) info->a << dstfmt->Ashift;
+        } else {
+            sw->andmask = srcfmt->Rmask | srcfmt->Gmask | srcfmt->Bmask;
+        }
+    } else if (!(srcfmt->Amask && dstfmt->Amask)) {
+        sw->pattern[alpha_channel] = 0x80;
+        if (dstfmt->Amask) {
+            sw->ormask = (Uint32) info->a << dstfmt->Ashift;
+        } else if (!keyed && (IsInversedRGB(srcfmt, dstfmt) || (srcbpp == 3 && same_rgb))) {
+            /* Blit_3or4_to_3or4__same_rgb and __inversed_rgb only write the color bytes */
+            sw->keepmask = 0xFFu << (8 * alpha_channel);
+        }
+    }
+}
+
+/* Four pixels worth of shuffle, for 12 or 16 source and destination bytes */
+static void
+get_swizzle_shuffle(const struct swizzle *sw, int srcbpp, int dstbpp, Uint8 shuffle[16])
+{
+    int i, j;
+
+    SDL_memset(shuffle, 0x80, 16);
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < dstbpp; ++j) {
+            if (sw->pattern[j] != 0x80) {
+                shuffle[i * dstbpp + j] = (Uint8) (i * srcbpp + sw->pattern[j]);
+            }
+        }
+    }
+}
+
+/* The C version of the shuffle, for the pixels at the end of a row */
+static void
+SwizzlePixels(const Uint8 * src, int srcbpp, Uint8 * dst, int dstbpp, int n,
+              const struct swizzle *sw, SDL_bool keyed)
+{
+    while (n--) {
+        Uint32 pixel = 0, dpixel = 0;
+        int i;
+
+        if (keyed) {
+            SDL_memcpy(&pixel, src, sizeof (pixel));
+            if ((pixel & sw->ckeymask) == sw->ckey) {
+                src += srcbpp;
+                dst += dstbpp;
+                continue;
+            }
+            pixel = 0;
+        }
+        for (i = 0; i < dstbpp; ++i) {
+            if (sw->pattern[i] != 0x80) {
+                pixel |= (Uint32) src[sw->pattern[i]] << (8 * i);
+            }
+        }
+        SDL_memcpy(&dpixel, dst, dstbpp);
+        pixel = (pixel & sw->andmask) | sw->ormask | (dpixel & sw->keepmask);
+        SDL_memcpy(dst, &pixel, dstbpp);
+        src += srcbpp;
+        dst += dstbpp;
+    }
+}
+#endif /* SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS */
+
+#if SDL_SSE4_1_INTRINSICS
+SDL_FORCE_INLINE SDL_TARGETING("sse4.1") void
+Blit4to4Swizzle_SSE41(SDL_BlitInfo * info, const SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m128i shuffle, andmask, ormask, keepmask, ckey, ckeymask;
+
+    get_swizzle(info, keyed, &sw);
+    get_swizzle_shuffle(&sw, 4, 4, pattern);
+    shuffle = _mm_loadu_si128((const __m128i *) pattern);
+    andmask = _mm_set1_epi32(sw.andmask);
+    ormask = _mm_set1_epi32(sw.ormask);
+    keepmask = _mm_set1_epi32(sw.keepmask);
+    ckey = _mm_set1_epi32(sw.ckey);
+    ckeymask = _mm_set1_epi32(sw.ckeymask);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 4; n -= 4, src += 16, dst += 16) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) src);
+            __m128i out = _mm_or_si128(_mm_and_si128(_mm_shuffle_epi8(s, shuffle), andmask), ormask);
+            if (keyed || sw.keepmask) {
+                const __m128i d = _mm_loadu_si128((const __m128i *) dst);
+                out = _mm_or_si128(out, _mm_and_si128(d, keepmask));
+                if (keyed) {
+                    out = _mm_blendv_epi8(out, d, _mm_cmpeq_epi32(_mm_and_si128(s, ckeymask), ckey));
+                }
+            }
+            _mm_storeu_si128((__m128i *) dst, out);
+        }
+        SwizzlePixels(src, 4, dst, 4, n, &sw, keyed);
+        src += n * 4 + srcskip;
+        dst += n * 4 + dstskip;
+    }
+}
+
+static void SDL_TARGETING("sse4.1")
+Blit4to4SwizzleSSE41(SDL_BlitInfo * info)
+{
+    Blit4to4Swizzle_SSE41(info, SDL_FALSE);
+}
+
+static void SDL_TARGETING("sse4.1")
+Blit4to4KeySwizzleSSE41(SDL_BlitInfo * info)
+{
+    Blit4to4Swizzle_SSE41(info, SDL_TRUE);
+}
+
+static void SDL_TARGETING("sse4.1")
+Blit3to4SwizzleSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m128i shuffle, ormask, keepmask;
+
+    get_swizzle(info, SDL_FALSE, &sw);
+    get_swizzle_shuffle(&sw, 3, 4, pattern);
+    shuffle = _mm_loadu_si128((const __m128i *) pattern);
+    ormask = _mm_set1_epi32(sw.ormask);
+    keepmask = _mm_set1_epi32(sw.keepmask);
+
+    while (height--) {
+        int n;
+        /* Each step reads 16 bytes to use 12, so stop while there are two pixels to spare */
+        for (n = width; n >= 6; n -= 4, src += 12, dst += 16) {
+            __m128i out = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) src), shuffle), ormask);
+            if (sw.keepmask) {
+                out = _mm_or_si128(out, _mm_and_si128(_mm_loadu_si128((const __m128i *) dst), keepmask));
+            }
+            _mm_storeu_si128((__m128i *) dst, out);
+        }
+        SwizzlePixels(src, 3, dst, 4, n, &sw, SDL_FALSE);
+        src += n * 3 + srcskip;
+        dst += n * 4 + dstskip;
+    }
+}
+
+static void SDL_TARGETING("sse4.1")
+Blit4to3SwizzleSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m128i shuffle;
+
+    get_swizzle(info, SDL_FALSE, &sw);
+    get_swizzle_shuffle(&sw, 4, 3, pattern);
+    shuffle = _mm_loadu_si128((const __m128i *) pattern);
+
+    while (height--) {
+        int n;
+        /* Each step writes 16 bytes for 12, the next step overwrites the extra ones */
+        for (n = width; n >= 6; n -= 4, src += 16, dst += 12) {
+            _mm_storeu_si128((__m128i *) dst, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) src), shuffle));
+        }
+        SwizzlePixels(src, 4, dst, 3, n, &sw, SDL_FALSE);
+        src += n * 4 + srcskip;
+        dst += n * 3 + dstskip;
+    }
+}
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+SDL_FORCE_INLINE SDL_TARGETING("avx2") void
+Blit4to4Swizzle_AVX2(SDL_BlitInfo * info, const SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m256i shuffle, andmask, ormask, keepmask, ckey, ckeymask;
+
+    get_swizzle(info, keyed, &sw);
+    get_swizzle_shuffle(&sw, 4, 4, pattern);
+    shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) pattern));
+    andmask = _mm256_set1_epi32(sw.andmask);
+    ormask = _mm256_set1_epi32(sw.ormask);
+    keepmask = _mm256_set1_epi32(sw.keepmask);
+    ckey = _mm256_set1_epi32(sw.ckey);
+    ckeymask = _mm256_set1_epi32(sw.ckeymask);
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 8; n -= 8, src += 32, dst += 32) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) src);
+            __m256i out = _mm256_or_si256(_mm256_and_si256(_mm256_shuffle_epi8(s, shuffle), andmask), ormask);
+            if (keyed || sw.keepmask) {
+                const __m256i d = _mm256_loadu_si256((const __m256i *) dst);
+                out = _mm256_or_si256(out, _mm256_and_si256(d, keepmask));
+                if (keyed) {
+                    out = _mm256_blendv_epi8(out, d, _mm256_cmpeq_epi32(_mm256_and_si256(s, ckeymask), ckey));
+                }
+            }
+            _mm256_storeu_si256((__m256i *) dst, out);
+        }
+        SwizzlePixels(src, 4, dst, 4, n, &sw, keyed);
+        src += n * 4 + srcskip;
+        dst += n * 4 + dstskip;
+    }
+}
+
+static void SDL_TARGETING("avx2")
+Blit4to4SwizzleAVX2(SDL_BlitInfo * info)
+{
+    Blit4to4Swizzle_AVX2(info, SDL_FALSE);
+}
+
+static void SDL_TARGETING("avx2")
+Blit4to4KeySwizzleAVX2(SDL_BlitInfo * info)
+{
+    Blit4to4Swizzle_AVX2(info, SDL_TRUE);
+}
+
+static void SDL_TARGETING("avx2")
+Blit3to4SwizzleAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m256i shuffle, ormask, keepmask, loadmask, spread;
+
+    get_swizzle(info, SDL_FALSE, &sw);
+    get_swizzle_shuffle(&sw, 3, 4, pattern);
+    shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) pattern));
+    ormask = _mm256_set1_epi32(sw.ormask);
+    keepmask = _mm256_set1_epi32(sw.keepmask);
+    loadmask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    spread = _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 5, 5);    /* 12 source bytes per lane */
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 8; n -= 8, src += 24, dst += 32) {
+            __m256i s = _mm256_maskload_epi32((const int *) src, loadmask);
+            __m256i out = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(s, spread), shuffle), ormask);
+            if (sw.keepmask) {
+                out = _mm256_or_si256(out, _mm256_and_si256(_mm256_loadu_si256((const __m256i *) dst), keepmask));
+            }
+            _mm256_storeu_si256((__m256i *) dst, out);
+        }
+        SwizzlePixels(src, 3, dst, 4, n, &sw, SDL_FALSE);
+        src += n * 3 + srcskip;
+        dst += n * 4 + dstskip;
+    }
+}
+
+static void SDL_TARGETING("avx2")
+Blit4to3SwizzleAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    struct swizzle sw;
+    Uint8 pattern[16];
+    __m256i shuffle, storemask, gather;
+
+    get_swizzle(info, SDL_FALSE, &sw);
+    get_swizzle_shuffle(&sw, 4, 3, pattern);
+    shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) pattern));
+    storemask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    gather = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);    /* 12 destination bytes per lane */
+
+    while (height--) {
+        int n;
+        for (n = width; n >= 8; n -= 8, src += 32, dst += 24) {
+            const __m256i s = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) src), shuffle);
+            _mm256_maskstore_epi32((int *) dst, storemask, _mm256_permutevar8x32_epi32(s, gather));
+        }
+        SwizzlePixels(src, 4, dst, 3, n, &sw, SDL_FALSE);
+        src += n * 4 + srcskip;
+        dst += n * 3 + dstskip;
+    }
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+static SDL_BlitFunc
+GetSwizzleBlitter(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt, SDL_bool keyed)
+{
+    const int features = GetBlitFeatures();
+    const int srcbpp = srcfmt->BytesPerPixel;
+    const int dstbpp = dstfmt->BytesPerPixel;
+
+    if (!SwizzleSupported(srcfmt) || !SwizzleSupported(dstfmt)) {
+        return NULL;
+    }
+    if (keyed && !(srcbpp == 4 && dstbpp == 4)) {
+        return NULL;
+    }
+
+#if SDL_AVX2_INTRINSICS
+    if (features & BLIT_FEATURE_HAS_AVX2) {
+        if (srcbpp == 4 && dstbpp == 4) {
+            return keyed ? Blit4to4KeySwizzleAVX2 : Blit4to4SwizzleAVX2;
+        } else if (srcbpp == 3 && dstbpp == 4) {
+            return Blit3to4SwizzleAVX2;
+        } else if (srcbpp == 4 && dstbpp == 3) {
+            return Blit4to3SwizzleAVX2;
+        }
+    }
+#endif
+#if SDL_SSE4_1_INTRINSICS
+    if (features & BLIT_FEATURE_HAS_SSE41) {
+        if (srcbpp == 4 && dstbpp == 4) {
+            return keyed ? Blit4to4KeySwizzleSSE41 : Blit4to4SwizzleSSE41;
+        } else if (srcbpp == 3 && dstbpp == 4) {
+            return Blit3to4SwizzleSSE41;
+        } else if (srcbpp == 4 && dstbpp == 3) {
+            return Blit4to3SwizzleSSE41;
+        }
+    }
+#endif
+    return NULL;
+}
+#endif /* SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS */
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3437,6 +3869,20 @@ SDL_CalculateBlitN(SDL_Surface * surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+            /* The byte shuffles produce the same pixels as these C blitters */
+            if ((blitfun == BlitNtoN || blitfun == BlitNtoNCopyAlpha ||
+                 blitfun == Blit4to4MaskAlpha ||
+                 blitfun == Blit_3or4_to_3or4__same_rgb ||
+                 blitfun == Blit_3or4_to_3or4__inversed_rgb) &&
+                (srcfmt->BytesPerPixel == 4 || dstfmt->BytesPerPixel == 4)) {
+                SDL_BlitFunc swizzle = GetSwizzleBlitter(srcfmt, dstfmt, SDL_FALSE);
+                if (swizzle) {
+                    blitfun = swizzle;
+                }
+            }
+#endif
         }
         return (blitfun);
 
@@ -3452,9 +3898,14 @@ SDL_CalculateBlitN(SDL_Surface * surface)
         else {
 #if SDL_ALTIVEC_BLITTERS
             if ((srcfmt->BytesPerPixel == 4) && (dstfmt->BytesPerPixel == 4)
-                && SDL_HasAltiVec()) {
+                && (SDL_GetCPUDispatch(SDL_CPU_KERNEL_BLIT_CONVERT) & CPU_HAS_ALTIVEC)) {
                 return Blit32to32KeyAltivec;
             } else
+#endif
+#if SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS
+            if ((blitfun = GetSwizzleBlitter(srcfmt, dstfmt, SDL_TRUE)) != NULL) {
+                return blitfun;
+            } else
 #endif
             if (srcfmt->Amask && dstfmt->Amask) {
                 return BlitNtoNKeyCopyAlpha;
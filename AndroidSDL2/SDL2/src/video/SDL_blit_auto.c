@@ -28,6 +28,11 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "SDL_cpuinfo.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
 
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
@@ -7544,132 +7549,3216 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if HAVE_SSE2_INTRINSICS || SDL_AVX2_INTRINSICS
+/* How the SIMD blitters get from a source to a destination pixel */
+#define SDL_BLIT_SIMD_SRC_ROTATE    0x0001  /* source alpha is in the low byte */
+#define SDL_BLIT_SIMD_SRC_SWAP      0x0002  /* source red and blue are swapped */
+#define SDL_BLIT_SIMD_SRC_ALPHA     0x0004  /* source has alpha */
+#define SDL_BLIT_SIMD_DST_SWAP      0x0008  /* destination red and blue are swapped */
+#define SDL_BLIT_SIMD_DST_ALPHA     0x0010  /* destination has alpha */
+#define SDL_BLIT_SIMD_MODULATE      0x0020
+#define SDL_BLIT_SIMD_BLEND         0x0040
+#define SDL_BLIT_SIMD_SCALE         0x0080
+#define SDL_BLIT_SIMD_COPY          0x0100  /* same format, pixels are copied untouched */
+#endif
+
+#if HAVE_SSE2_INTRINSICS
+
+#define SDL_BLIT_SSE2_PIXELS 4
+
+SDL_FORCE_INLINE __m128i
+SDL_Blit_Gather_SSE2(const Uint32 *src, int posx, int incx)
+{
+    return _mm_setr_epi32(src[posx >> 16], src[(posx + incx) >> 16],
+                          src[(posx + 2 * incx) >> 16], src[(posx + 3 * incx) >> 16]);
+}
+
+/* Exact x / 255 for 0 <= x <= 255 * 255 */
+SDL_FORCE_INLINE __m128i
+SDL_Blit_Div255_SSE2(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE __m128i
+SDL_Blit_SwapRB_SSE2(__m128i p)
+{
+    const __m128i rb = _mm_and_si128(p, _mm_set1_epi32(0x00FF00FF));
+    return _mm_or_si128(_mm_and_si128(p, _mm_set1_epi32(0xFF00FF00)),
+                        _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16)));
+}
+
+/* Blends unpacked source and destination pixels, both in B, G, R, A lane order */
+SDL_FORCE_INLINE __m128i
+SDL_Blit_Blend_SSE2(__m128i s, __m128i d, const int mode, const int layout)
+{
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i alphamask = _mm_unpacklo_epi8(_mm_set1_epi32(0xFF000000), _mm_set1_epi32(0xFF000000));
+    const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i k, ge;
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_ADD:
+        /* This goes away if we ever use premultiplied alpha */
+        s = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(s, _mm_or_si128(_mm_andnot_si128(alphamask, a), _mm_and_si128(alphamask, ff))));
+        if (mode == SDL_COPY_BLEND) {
+            return _mm_add_epi16(s, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(_mm_sub_epi16(ff, a), d)));
+        }
+        return _mm_or_si128(_mm_andnot_si128(alphamask, _mm_min_epi16(_mm_add_epi16(s, d), ff)), _mm_and_si128(alphamask, d));
+    case SDL_COPY_MOD:
+        return _mm_or_si128(_mm_andnot_si128(alphamask, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(s, d))), _mm_and_si128(alphamask, d));
+    case SDL_COPY_MUL:
+        /* (s * d + d * (255 - a)) / 255 can overflow 16 bits, so split off a whole d when the factor is 255 or more */
+        k = _mm_add_epi16(s, _mm_sub_epi16(ff, a));
+        ge = _mm_cmpgt_epi16(k, _mm_set1_epi16(254));
+        k = _mm_sub_epi16(k, _mm_and_si128(ge, ff));
+        d = _mm_min_epi16(_mm_add_epi16(SDL_Blit_Div255_SSE2(_mm_mullo_epi16(d, k)), _mm_and_si128(ge, d)), ff);
+        if (!(layout & (SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_MODULATE))) {
+            d = _mm_or_si128(d, _mm_and_si128(alphamask, ff));
+        }
+        return d;
+    default:
+        return d;
+    }
+}
+
+SDL_FORCE_INLINE void
+SDL_Blit_SSE2(SDL_BlitInfo *info, const int layout)
+{
+    const int flags = info->flags;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const Uint32 modulateRGB = (flags & SDL_COPY_MODULATE_COLOR) ? ((info->r << 16) | (info->g << 8) | info->b) : 0xFFFFFF;
+    const Uint32 modulate = (((layout & SDL_BLIT_SIMD_SRC_ALPHA) ? modulateA : 0xFF) << 24) | modulateRGB;
+    const SDL_bool do_modulate = (layout & SDL_BLIT_SIMD_MODULATE) && modulate != 0xFFFFFFFF;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mod16 = _mm_unpacklo_epi8(_mm_set1_epi32(modulate), zero);
+    const __m128i srcA = _mm_set1_epi32(((layout & SDL_BLIT_SIMD_MODULATE) ? modulateA : 0xFF) << 24);
+    const __m128i dstmask = _mm_set1_epi32((layout & SDL_BLIT_SIMD_DST_ALPHA) ? 0xFFFFFFFF : 0x00FFFFFF);
+    int srcy = 0, posy = 0;
+    int incx = 0, incy = 0;
+
+    if (layout & SDL_BLIT_SIMD_SCALE) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        if (layout & SDL_BLIT_SIMD_SCALE) {
+            while (posy >= 0x10000L) {
+                ++srcy;
+                posy -= 0x10000L;
+            }
+            src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+
+        for (; n > 0; n -= SDL_BLIT_SSE2_PIXELS, dst += SDL_BLIT_SSE2_PIXELS) {
+            Uint32 buf[SDL_BLIT_SSE2_PIXELS];
+            const int count = SDL_min(n, SDL_BLIT_SSE2_PIXELS);
+            __m128i s, d, lo, hi;
+            int i;
+
+            if (count < SDL_BLIT_SSE2_PIXELS) {
+                SDL_zeroa(buf);
+            }
+            if (layout & SDL_BLIT_SIMD_SCALE) {
+                if (count < SDL_BLIT_SSE2_PIXELS) {
+                    for (i = 0; i < count; ++i) {
+                        buf[i] = src[posx >> 16];
+                        posx += incx;
+                    }
+                    s = _mm_loadu_si128((const __m128i *)buf);
+                } else {
+                    s = SDL_Blit_Gather_SSE2(src, posx, incx);
+                    posx += SDL_BLIT_SSE2_PIXELS * incx;
+                }
+            } else {
+                if (count < SDL_BLIT_SSE2_PIXELS) {
+                    SDL_memcpy(buf, src, count * sizeof (Uint32));
+                    s = _mm_loadu_si128((const __m128i *)buf);
+                } else {
+                    s = _mm_loadu_si128((const __m128i *)src);
+                }
+                src += SDL_BLIT_SSE2_PIXELS;
+            }
+
+            if (!(layout & SDL_BLIT_SIMD_COPY)) {
+                /* Put the source in B, G, R, A order */
+                if (layout & SDL_BLIT_SIMD_SRC_ROTATE) {
+                    s = _mm_or_si128(_mm_srli_epi32(s, 8), _mm_slli_epi32(s, 24));
+                }
+                if (layout & SDL_BLIT_SIMD_SRC_SWAP) {
+                    s = SDL_Blit_SwapRB_SSE2(s);
+                }
+                if (!(layout & SDL_BLIT_SIMD_SRC_ALPHA)) {
+                    s = _mm_or_si128(_mm_and_si128(s, _mm_set1_epi32(0x00FFFFFF)), srcA);
+                }
+                lo = _mm_unpacklo_epi8(s, zero);
+                hi = _mm_unpackhi_epi8(s, zero);
+
+                if (do_modulate) {
+                    lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(lo, mod16));
+                    hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(hi, mod16));
+                }
+
+                if (layout & SDL_BLIT_SIMD_BLEND) {
+                    if (count < SDL_BLIT_SSE2_PIXELS) {
+                        SDL_memcpy(buf, dst, count * sizeof (Uint32));
+                        d = _mm_loadu_si128((const __m128i *)buf);
+                    } else {
+                        d = _mm_loadu_si128((const __m128i *)dst);
+                    }
+                    if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                        d = SDL_Blit_SwapRB_SSE2(d);
+                    }
+                    lo = SDL_Blit_Blend_SSE2(lo, _mm_unpacklo_epi8(d, zero), mode, layout);
+                    hi = SDL_Blit_Blend_SSE2(hi, _mm_unpackhi_epi8(d, zero), mode, layout);
+                }
+
+                s = _mm_packus_epi16(lo, hi);
+                if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                    s = SDL_Blit_SwapRB_SSE2(s);
+                }
+                s = _mm_and_si128(s, dstmask);
+            }
+
+            if (count < SDL_BLIT_SSE2_PIXELS) {
+                _mm_storeu_si128((__m128i *)buf, s);
+                SDL_memcpy(dst, buf, count * sizeof (Uint32));
+            } else {
+                _mm_storeu_si128((__m128i *)dst, s);
+            }
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_BLEND | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_MODULATE | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_MODULATE | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    SDL_Blit_SSE2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if SDL_AVX2_INTRINSICS
+
+#define SDL_BLIT_AVX2_PIXELS 8
+
+SDL_FORCE_INLINE SDL_TARGETING("avx2") __m256i
+SDL_Blit_Gather_AVX2(const Uint32 *src, int posx, int incx)
+{
+    const __m256i pos = _mm256_add_epi32(_mm256_set1_epi32(posx),
+                                         _mm256_mullo_epi32(_mm256_set1_epi32(incx), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    return _mm256_i32gather_epi32((const int *)src, _mm256_srli_epi32(pos, 16), 4);
+}
+
+/* Exact x / 255 for 0 <= x <= 255 * 255 */
+SDL_FORCE_INLINE SDL_TARGETING("avx2") __m256i
+SDL_Blit_Div255_AVX2(__m256i x)
+{
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(1));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE SDL_TARGETING("avx2") __m256i
+SDL_Blit_SwapRB_AVX2(__m256i p)
+{
+    const __m256i rb = _mm256_and_si256(p, _mm256_set1_epi32(0x00FF00FF));
+    return _mm256_or_si256(_mm256_and_si256(p, _mm256_set1_epi32(0xFF00FF00)),
+                        _mm256_or_si256(_mm256_slli_epi32(rb, 16), _mm256_srli_epi32(rb, 16)));
+}
+
+/* Blends unpacked source and destination pixels, both in B, G, R, A lane order */
+SDL_FORCE_INLINE SDL_TARGETING("avx2") __m256i
+SDL_Blit_Blend_AVX2(__m256i s, __m256i d, const int mode, const int layout)
+{
+    const __m256i ff = _mm256_set1_epi16(0xFF);
+    const __m256i alphamask = _mm256_unpacklo_epi8(_mm256_set1_epi32(0xFF000000), _mm256_set1_epi32(0xFF000000));
+    const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i k, ge;
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_ADD:
+        /* This goes away if we ever use premultiplied alpha */
+        s = SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(s, _mm256_or_si256(_mm256_andnot_si256(alphamask, a), _mm256_and_si256(alphamask, ff))));
+        if (mode == SDL_COPY_BLEND) {
+            return _mm256_add_epi16(s, SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(ff, a), d)));
+        }
+        return _mm256_or_si256(_mm256_andnot_si256(alphamask, _mm256_min_epi16(_mm256_add_epi16(s, d), ff)), _mm256_and_si256(alphamask, d));
+    case SDL_COPY_MOD:
+        return _mm256_or_si256(_mm256_andnot_si256(alphamask, SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(s, d))), _mm256_and_si256(alphamask, d));
+    case SDL_COPY_MUL:
+        /* (s * d + d * (255 - a)) / 255 can overflow 16 bits, so split off a whole d when the factor is 255 or more */
+        k = _mm256_add_epi16(s, _mm256_sub_epi16(ff, a));
+        ge = _mm256_cmpgt_epi16(k, _mm256_set1_epi16(254));
+        k = _mm256_sub_epi16(k, _mm256_and_si256(ge, ff));
+        d = _mm256_min_epi16(_mm256_add_epi16(SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(d, k)), _mm256_and_si256(ge, d)), ff);
+        if (!(layout & (SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_MODULATE))) {
+            d = _mm256_or_si256(d, _mm256_and_si256(alphamask, ff));
+        }
+        return d;
+    default:
+        return d;
+    }
+}
+
+SDL_FORCE_INLINE SDL_TARGETING("avx2") void
+SDL_Blit_AVX2(SDL_BlitInfo *info, const int layout)
+{
+    const int flags = info->flags;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const Uint32 modulateRGB = (flags & SDL_COPY_MODULATE_COLOR) ? ((info->r << 16) | (info->g << 8) | info->b) : 0xFFFFFF;
+    const Uint32 modulate = (((layout & SDL_BLIT_SIMD_SRC_ALPHA) ? modulateA : 0xFF) << 24) | modulateRGB;
+    const SDL_bool do_modulate = (layout & SDL_BLIT_SIMD_MODULATE) && modulate != 0xFFFFFFFF;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i mod16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(modulate), zero);
+    const __m256i srcA = _mm256_set1_epi32(((layout & SDL_BLIT_SIMD_MODULATE) ? modulateA : 0xFF) << 24);
+    const __m256i dstmask = _mm256_set1_epi32((layout & SDL_BLIT_SIMD_DST_ALPHA) ? 0xFFFFFFFF : 0x00FFFFFF);
+    int srcy = 0, posy = 0;
+    int incx = 0, incy = 0;
+
+    if (layout & SDL_BLIT_SIMD_SCALE) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        if (layout & SDL_BLIT_SIMD_SCALE) {
+            while (posy >= 0x10000L) {
+                ++srcy;
+                posy -= 0x10000L;
+            }
+            src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+
+        for (; n > 0; n -= SDL_BLIT_AVX2_PIXELS, dst += SDL_BLIT_AVX2_PIXELS) {
+            Uint32 buf[SDL_BLIT_AVX2_PIXELS];
+            const int count = SDL_min(n, SDL_BLIT_AVX2_PIXELS);
+            __m256i s, d, lo, hi;
+            int i;
+
+            if (count < SDL_BLIT_AVX2_PIXELS) {
+                SDL_zeroa(buf);
+            }
+            if (layout & SDL_BLIT_SIMD_SCALE) {
+                if (count < SDL_BLIT_AVX2_PIXELS) {
+                    for (i = 0; i < count; ++i) {
+                        buf[i] = src[posx >> 16];
+                        posx += incx;
+                    }
+                    s = _mm256_loadu_si256((const __m256i *)buf);
+                } else {
+                    s = SDL_Blit_Gather_AVX2(src, posx, incx);
+                    posx += SDL_BLIT_AVX2_PIXELS * incx;
+                }
+            } else {
+                if (count < SDL_BLIT_AVX2_PIXELS) {
+                    SDL_memcpy(buf, src, count * sizeof (Uint32));
+                    s = _mm256_loadu_si256((const __m256i *)buf);
+                } else {
+                    s = _mm256_loadu_si256((const __m256i *)src);
+                }
+                src += SDL_BLIT_AVX2_PIXELS;
+            }
+
+            if (!(layout & SDL_BLIT_SIMD_COPY)) {
+                /* Put the source in B, G, R, A order */
+                if (layout & SDL_BLIT_SIMD_SRC_ROTATE) {
+                    s = _mm256_or_si256(_mm256_srli_epi32(s, 8), _mm256_slli_epi32(s, 24));
+                }
+                if (layout & SDL_BLIT_SIMD_SRC_SWAP) {
+                    s = SDL_Blit_SwapRB_AVX2(s);
+                }
+                if (!(layout & SDL_BLIT_SIMD_SRC_ALPHA)) {
+                    s = _mm256_or_si256(_mm256_and_si256(s, _mm256_set1_epi32(0x00FFFFFF)), srcA);
+                }
+                lo = _mm256_unpacklo_epi8(s, zero);
+                hi = _mm256_unpackhi_epi8(s, zero);
+
+                if (do_modulate) {
+                    lo = SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(lo, mod16));
+                    hi = SDL_Blit_Div255_AVX2(_mm256_mullo_epi16(hi, mod16));
+                }
+
+                if (layout & SDL_BLIT_SIMD_BLEND) {
+                    if (count < SDL_BLIT_AVX2_PIXELS) {
+                        SDL_memcpy(buf, dst, count * sizeof (Uint32));
+                        d = _mm256_loadu_si256((const __m256i *)buf);
+                    } else {
+                        d = _mm256_loadu_si256((const __m256i *)dst);
+                    }
+                    if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                        d = SDL_Blit_SwapRB_AVX2(d);
+                    }
+                    lo = SDL_Blit_Blend_AVX2(lo, _mm256_unpacklo_epi8(d, zero), mode, layout);
+                    hi = SDL_Blit_Blend_AVX2(hi, _mm256_unpackhi_epi8(d, zero), mode, layout);
+                }
+
+                s = _mm256_packus_epi16(lo, hi);
+                if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                    s = SDL_Blit_SwapRB_AVX2(s);
+                }
+                s = _mm256_and_si256(s, dstmask);
+            }
+
+            if (count < SDL_BLIT_AVX2_PIXELS) {
+                _mm256_storeu_si256((__m256i *)buf, s);
+                SDL_memcpy(dst, buf, count * sizeof (Uint32));
+            } else {
+                _mm256_storeu_si256((__m256i *)dst, s);
+            }
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_BLEND | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_MODULATE | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_MODULATE | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_COPY | SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_SWAP |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_AVX2(info, SDL_BLIT_SIMD_SRC_ROTATE |
+                  SDL_BLIT_SIMD_SRC_SWAP |
+                  SDL_BLIT_SIMD_SRC_ALPHA |
+                  SDL_BLIT_SIMD_DST_ALPHA |
+                  SDL_BLIT_SIMD_MODULATE |
+                  SDL_BLIT_SIMD_BLEND |
+                  SDL_BLIT_SIMD_SCALE);
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#if SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#if HAVE_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
@@ -28,6 +28,12 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_cpuinfo.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -196,12 +202,220 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
+/* The rows above step through the source one pixel at a time, which means
+   that destination pixel i comes from source pixel (i * inc) >> 16. The
+   vectorized rows below index the source with that directly.
+*/
+#if HAVE_SSE2_INTRINSICS
+static void
+copy_row4_SSE2(Uint32 * src, int src_w, Uint32 * dst, int dst_w)
+{
+    const int inc = (src_w << 16) / dst_w;
+    int i, pos = 0;
+
+    for (i = 0; i + 4 <= dst_w; i += 4) {
+        const Uint32 p0 = src[pos >> 16];
+        const Uint32 p1 = src[(pos + inc) >> 16];
+        const Uint32 p2 = src[(pos + 2 * inc) >> 16];
+        const Uint32 p3 = src[(pos + 3 * inc) >> 16];
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_setr_epi32(p0, p1, p2, p3));
+        pos += 4 * inc;
+    }
+    for (; i < dst_w; ++i) {
+        dst[i] = src[pos >> 16];
+        pos += inc;
+    }
+}
+#endif
+
+#if SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+copy_row4_AVX2(Uint32 * src, int src_w, Uint32 * dst, int dst_w)
+{
+    const int inc = (src_w << 16) / dst_w;
+    const __m256i step = _mm256_set1_epi32(8 * inc);
+    __m256i pos = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(inc));
+    int i;
+
+    for (i = 0; i + 8 <= dst_w; i += 8) {
+        const __m256i idx = _mm256_srli_epi32(pos, 16);
+        _mm256_storeu_si256((__m256i *) (dst + i), _mm256_i32gather_epi32((const int *) src, idx, 4));
+        pos = _mm256_add_epi32(pos, step);
+    }
+    for (; i < dst_w; ++i) {
+        dst[i] = src[(i * inc) >> 16];
+    }
+}
+#endif
+
+typedef void (*SDL_StretchRow4Func)(Uint32 * src, int src_w, Uint32 * dst, int dst_w);
+
+static SDL_StretchRow4Func
+SDL_ChooseStretchRow4(void)
+{
+#if SDL_AVX2_INTRINSICS
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_STRETCH) & CPU_HAS_AVX2) {
+        return copy_row4_AVX2;
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_STRETCH) & CPU_HAS_SSE2) {
+        return copy_row4_SSE2;
+    }
+#endif
+    return copy_row4;
+}
+
+/* Bilinear filtering.
+   Each of the four bytes of a pixel is interpolated on its own, with 8 bits
+   of subpixel precision, first across the two source rows and then between
+   them. Destination pixel centers are mapped onto source pixel centers, and
+   samples past the edges are clamped.
+*/
+static SDL_INLINE Uint32
+lerp_pixel(Uint32 a, Uint32 b, Uint32 frac)
+{
+    /* Two bytes at a time: each 16-bit lane holds at most 255 * 256 */
+    const Uint32 rb = ((((a & 0x00FF00FF) * (256 - frac)) + ((b & 0x00FF00FF) * frac)) >> 8) & 0x00FF00FF;
+    const Uint32 ga = ((((a >> 8) & 0x00FF00FF) * (256 - frac)) + (((b >> 8) & 0x00FF00FF) * frac)) & 0xFF00FF00;
+    return rb | ga;
+}
+
+/* Maps destination position pos (16.16 fixed point) to the source index and 8-bit fraction */
+#define LINEAR_SAMPLE(pos, max, index, frac)        \
+    do {                                            \
+        const int p_ = (pos) < 0 ? 0 : ((pos) > (max) ? (max) : (pos)); \
+        index = p_ >> 16;                           \
+        frac = (p_ >> 8) & 0xFF;                    \
+    } while (0)
+
+static void
+linear_row4(const Uint32 * row0, const Uint32 * row1, Uint32 frac_y,
+            int src_w, Uint32 * dst, int dst_w)
+{
+    const int inc = (src_w << 16) / dst_w;
+    const int max = (src_w - 1) << 16;
+    int i, pos = inc / 2 - 0x8000;
+
+    for (i = 0; i < dst_w; ++i, pos += inc) {
+        int x0;
+        Uint32 frac_x, x1;
+        LINEAR_SAMPLE(pos, max, x0, frac_x);
+        x1 = x0 + (frac_x != 0);  /* the last column always has frac_x == 0 */
+        dst[i] = lerp_pixel(lerp_pixel(row0[x0], row0[x1], frac_x),
+                            lerp_pixel(row1[x0], row1[x1], frac_x), frac_y);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* Same arithmetic as linear_row4(), two pixels at a time in 16-bit lanes */
+static void
+linear_row4_SSE2(const Uint32 * row0, const Uint32 * row1, Uint32 frac_y,
+                 int src_w, Uint32 * dst, int dst_w)
+{
+    const int inc = (src_w << 16) / dst_w;
+    const int max = (src_w - 1) << 16;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i wy1 = _mm_set1_epi16((short) frac_y);
+    const __m128i wy0 = _mm_set1_epi16((short) (256 - frac_y));
+    int i, pos = inc / 2 - 0x8000;
+
+    for (i = 0; i + 2 <= dst_w; i += 2) {
+        int a0, b0;
+        Uint32 fa, fb, a1, b1;
+        __m128i wx0, wx1, l, r, top, bottom, out;
+
+        LINEAR_SAMPLE(pos, max, a0, fa);
+        pos += inc;
+        LINEAR_SAMPLE(pos, max, b0, fb);
+        pos += inc;
+        a1 = a0 + (fa != 0);
+        b1 = b0 + (fb != 0);
+
+        wx1 = _mm_unpacklo_epi64(_mm_set1_epi16((short) fa), _mm_set1_epi16((short) fb));
+        wx0 = _mm_sub_epi16(_mm_set1_epi16(256), wx1);
+
+        l = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(row0[a0]), _mm_cvtsi32_si128(row0[b0])), zero);
+        r = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(row0[a1]), _mm_cvtsi32_si128(row0[b1])), zero);
+        top = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(l, wx0), _mm_mullo_epi16(r, wx1)), 8);
+
+        l = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(row1[a0]), _mm_cvtsi32_si128(row1[b0])), zero);
+        r = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(row1[a1]), _mm_cvtsi32_si128(row1[b1])), zero);
+        bottom = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(l, wx0), _mm_mullo_epi16(r, wx1)), 8);
+
+        out = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(top, wy0), _mm_mullo_epi16(bottom, wy1)), 8);
+        _mm_storel_epi64((__m128i *) (dst + i), _mm_packus_epi16(out, zero));
+    }
+
+    for (; i < dst_w; ++i, pos += inc) {
+        int x0;
+        Uint32 frac_x, x1;
+        LINEAR_SAMPLE(pos, max, x0, frac_x);
+        x1 = x0 + (frac_x != 0);
+        dst[i] = lerp_pixel(lerp_pixel(row0[x0], row0[x1], frac_x),
+                            lerp_pixel(row1[x0], row1[x1], frac_x), frac_y);
+    }
+}
+#endif
+
+typedef void (*SDL_LinearRow4Func)(const Uint32 * row0, const Uint32 * row1, Uint32 frac_y,
+                                   int src_w, Uint32 * dst, int dst_w);
+
+static int
+SDL_LowerSoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                           SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    const int inc = (srcrect->h << 16) / dstrect->h;
+    const int max = (srcrect->h - 1) << 16;
+    int i, pos = inc / 2 - 0x8000;
+    SDL_LinearRow4Func linear_row = linear_row4;
+
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_GetCPUDispatch(SDL_CPU_KERNEL_STRETCH) & CPU_HAS_SSE2) {
+        linear_row = linear_row4_SSE2;
+    }
+#endif
+
+    for (i = 0; i < dstrect->h; ++i, pos += inc) {
+        int y0;
+        Uint32 frac_y;
+        const Uint32 *row0, *row1;
+        Uint32 *dstp;
+
+        LINEAR_SAMPLE(pos, max, y0, frac_y);
+        row0 = (const Uint32 *) ((const Uint8 *) src->pixels + (srcrect->y + y0) * src->pitch) + srcrect->x;
+        row1 = frac_y ? (const Uint32 *) ((const Uint8 *) row0 + src->pitch) : row0;
+        dstp = (Uint32 *) ((Uint8 *) dst->pixels + (dstrect->y + i) * dst->pitch) + dstrect->x;
+        linear_row(row0, row1, frac_y, srcrect->w, dstp, dstrect->w);
+    }
+    return 0;
+}
+
+static int SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                                SDL_Surface * dst, const SDL_Rect * dstrect,
+                                SDL_BlitScaleMode scaleMode);
+
 /* Perform a stretch blit between two surfaces of the same format.
    NOTE:  This function is not safe to call from multiple threads!
 */
 int
 SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
                 SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    return SDL_UpperSoftStretch(src, srcrect, dst, dstrect, SDL_BLIT_SCALE_NEAREST);
+}
+
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    return SDL_UpperSoftStretch(src, srcrect, dst, dstrect, SDL_BLIT_SCALE_LINEAR);
+}
+
+static int
+SDL_UpperSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                     SDL_Surface * dst, const SDL_Rect * dstrect,
+                     SDL_BlitScaleMode scaleMode)
 {
     int src_locked;
     int dst_locked;
@@ -220,10 +434,18 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 #endif /* USE_ASM_STRETCH */
     const int bpp = dst->format->BytesPerPixel;
 
+    SDL_StretchRow4Func copy_row4_fast = copy_row4;
+
     if (src->format->format != dst->format->format) {
         return SDL_SetError("Only works with same format surfaces");
     }
 
+    if (scaleMode != SDL_BLIT_SCALE_NEAREST) {
+        if (bpp != 4 || src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+            return SDL_SetError("Bilinear scaling only works with 8 bits per channel 32-bit formats");
+        }
+    }
+
     /* Verify the blit rectangles */
     if (srcrect) {
         if ((srcrect->x < 0) || (srcrect->y < 0) ||
@@ -252,6 +474,10 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         dstrect = &full_dst;
     }
 
+    if (dstrect->w <= 0 || dstrect->h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return 0;
+    }
+
     /* Lock the destination if it's in hardware */
     dst_locked = 0;
     if (SDL_MUSTLOCK(dst)) {
@@ -272,6 +498,11 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         src_locked = 1;
     }
 
+    if (scaleMode != SDL_BLIT_SCALE_NEAREST) {
+        SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect);
+        goto done;
+    }
+
     /* Set up the data... */
     pos = 0x10000;
     inc = (srcrect->h << 16) / dstrect->h;
@@ -285,6 +516,10 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     }
 #endif
 
+    if (bpp == 4) {
+        copy_row4_fast = SDL_ChooseStretchRow4();
+    }
+
     /* Perform the stretch blit */
     for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
         dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
@@ -333,13 +568,14 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
                 copy_row3(srcp, srcrect->w, dstp, dstrect->w);
                 break;
             case 4:
-                copy_row4((Uint32 *) srcp, srcrect->w,
-                          (Uint32 *) dstp, dstrect->w);
+                copy_row4_fast((Uint32 *) srcp, srcrect->w,
+                               (Uint32 *) dstp, dstrect->w);
                 break;
             }
         pos += inc;
     }
 
+  done:
     /* We need to unlock the surfaces if they're locked */
     if (dst_locked) {
         SDL_UnlockSurface(dst);
@@ -723,6 +723,13 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateUpperBlitScaled(src, srcrect, dst, dstrect, SDL_BLIT_SCALE_NEAREST);
+}
+
+int
+SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect, SDL_BlitScaleMode scaleMode)
 {
     double src_x0, src_y0, src_x1, src_y1;
     double dst_x0, dst_y0, dst_x1, dst_y1;
@@ -867,7 +874,7 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
         return 0;
     }
 
-    return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
+    return SDL_PrivateLowerBlitScaled(src, &final_src, dst, &final_dst, scaleMode);
 }
 
 /**
@@ -877,6 +884,99 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
                 SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_BLIT_SCALE_NEAREST);
+}
+
+/* Bilinear scaling of anything SDL_SoftStretchLinear() can't do by itself:
+   the source rectangle is converted to ARGB8888 if needed, scaled into a
+   temporary surface, and that is blitted with the source's blend mode,
+   color and alpha modulation. Color keyed pixels become transparent.
+ */
+static int
+SDL_LowerBlitScaledLinear(SDL_Surface * src, SDL_Rect * srcrect,
+                          SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_Surface *converted = NULL, *scaled = NULL;
+    SDL_Rect rect, scaled_rect;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    Uint32 colorkey = 0;
+    int has_colorkey;
+    int retval = -1;
+
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    has_colorkey = (SDL_GetColorKey(src, &colorkey) == 0);
+
+    if (src->format->BytesPerPixel != 4 || src->format->format == SDL_PIXELFORMAT_ARGB2101010 || has_colorkey) {
+        /* Copy the pixels through a view of the source that has none of its blit settings */
+        SDL_Surface *view;
+
+        converted = SDL_CreateRGBSurfaceWithFormat(0, srcrect->w, srcrect->h, 32, SDL_PIXELFORMAT_ARGB8888);
+        if (!converted) {
+            return -1;
+        }
+        if (SDL_LockSurface(src) < 0) {
+            SDL_FreeSurface(converted);
+            return -1;
+        }
+        view = SDL_CreateRGBSurfaceWithFormatFrom(src->pixels, src->w, src->h, src->format->BitsPerPixel,
+                                                  src->pitch, src->format->format);
+        if (view) {
+            if (src->format->palette) {
+                SDL_SetSurfacePalette(view, src->format->palette);
+            }
+            if (has_colorkey) {
+                SDL_SetColorKey(view, SDL_TRUE, colorkey);
+            }
+            SDL_SetSurfaceBlendMode(view, SDL_BLENDMODE_NONE);
+            rect = *srcrect;
+            scaled_rect.x = scaled_rect.y = 0;
+            scaled_rect.w = srcrect->w;
+            scaled_rect.h = srcrect->h;
+            retval = SDL_LowerBlit(view, &rect, converted, &scaled_rect);
+            SDL_FreeSurface(view);
+        }
+        SDL_UnlockSurface(src);
+        if (retval < 0) {
+            SDL_FreeSurface(converted);
+            return -1;
+        }
+        src = converted;
+        rect.x = rect.y = 0;
+        rect.w = converted->w;
+        rect.h = converted->h;
+        srcrect = &rect;
+        if (has_colorkey && blendMode == SDL_BLENDMODE_NONE) {
+            blendMode = SDL_BLENDMODE_BLEND;
+        }
+    }
+
+    scaled = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 32, src->format->format);
+    if (scaled) {
+        retval = SDL_SoftStretchLinear(src, srcrect, scaled, NULL);
+        if (retval == 0) {
+            SDL_SetSurfaceBlendMode(scaled, blendMode);
+            SDL_SetSurfaceColorMod(scaled, r, g, b);
+            SDL_SetSurfaceAlphaMod(scaled, a);
+            scaled_rect.x = scaled_rect.y = 0;
+            scaled_rect.w = dstrect->w;
+            scaled_rect.h = dstrect->h;
+            retval = SDL_LowerBlit(scaled, &scaled_rect, dst, dstrect);
+        }
+        SDL_FreeSurface(scaled);
+    } else {
+        retval = -1;
+    }
+    SDL_FreeSurface(converted);
+    return retval;
+}
+
+int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                SDL_Surface * dst, SDL_Rect * dstrect, SDL_BlitScaleMode scaleMode)
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
@@ -884,6 +984,17 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_COPY_COLORKEY
     );
 
+    if (scaleMode != SDL_BLIT_SCALE_NEAREST) {
+        if ( !(src->map->info.flags & complex_copy_flags) &&
+             src->format->format == dst->format->format &&
+             src->format->BytesPerPixel == 4 &&
+             src->format->format != SDL_PIXELFORMAT_ARGB2101010 ) {
+            return SDL_SoftStretchLinear( src, srcrect, dst, dstrect );
+        } else {
+            return SDL_LowerBlitScaledLinear( src, srcrect, dst, dstrect );
+        }
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -24,6 +24,7 @@
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -189,7 +190,7 @@ static SDL_bool yuv_rgb_sse(
     YCbCrType yuv_type)
 {
 #ifdef __SSE2__
-    if (!SDL_HasSSE2()) {
+    if (!(SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2)) {
         return SDL_FALSE;
     }
 
@@ -964,7 +965,7 @@ SDL_ConvertPixels_PackUVPlanes_to_NV(int width, int height, const void *src, int
     Uint8 *dstUV;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     /* Skip the Y plane */
@@ -1038,7 +1039,7 @@ SDL_ConvertPixels_SplitNV_to_UVPlanes(int width, int height, const void *src, in
     Uint8 *dst1, *dst2;
     Uint8 *tmp = NULL;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     /* Skip the Y plane */
@@ -1116,7 +1117,7 @@ SDL_ConvertPixels_SwapNV(int width, int height, const void *src, int src_pitch,
     const Uint16 *srcUV;
     Uint16 *dstUV;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     /* Skip the Y plane */
@@ -1252,7 +1253,7 @@ SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -1294,7 +1295,7 @@ SDL_ConvertPixels_YUY2_to_YVYU(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -1336,7 +1337,7 @@ SDL_ConvertPixels_UYVY_to_YUY2(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -1378,7 +1379,7 @@ SDL_ConvertPixels_UYVY_to_YVYU(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -1420,7 +1421,7 @@ SDL_ConvertPixels_YVYU_to_YUY2(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -1462,7 +1463,7 @@ SDL_ConvertPixels_YVYU_to_UYVY(int width, int height, const void *src, int src_p
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
 #ifdef __SSE2__
-    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    const SDL_bool use_SSE2 = (SDL_GetCPUDispatch(SDL_CPU_KERNEL_YUV) & CPU_HAS_SSE2) ? SDL_TRUE : SDL_FALSE;
 #endif
 
     y = height;
@@ -657,6 +657,34 @@ DirectFB_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Textur
     return SDL_Unsupported();
 }
 
+static int
+DirectFB_QueueCopyBatch(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                        const SDL_RenderCopyItem * items, int count)
+{
+    DFBRectangle *verts;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (items[i].angle != 0.0 || items[i].flip != SDL_FLIP_NONE) {
+            return SDL_Unsupported();
+        }
+    }
+
+    verts = (DFBRectangle *) SDL_AllocateRenderVertices(renderer, count * 2 * sizeof (DFBRectangle), 0, &cmd->data.draw.first);
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; i++) {
+        SDLtoDFBRect(&items[i].srcrect, verts++);
+        SDLtoDFBRect_Float(&items[i].dstrect, verts++);
+    }
+
+    return 0;
+}
+
 
 static int
 DirectFB_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
@@ -752,21 +780,21 @@ DirectFB_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *
                 break;
             }
 
-            case SDL_RENDERCMD_COPY: {
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_BATCH: {
                 SDL_Texture *texture = cmd->data.draw.texture;
                 const Uint8 r = cmd->data.draw.r;
                 const Uint8 g = cmd->data.draw.g;
                 const Uint8 b = cmd->data.draw.b;
                 const Uint8 a = cmd->data.draw.a;
+                const size_t count = cmd->data.draw.count;
                 DFBRectangle *verts = (DFBRectangle *) (((Uint8 *) vertices) + cmd->data.draw.first);
                 DirectFB_TextureData *texturedata = (DirectFB_TextureData *) texture->driverdata;
-                DFBRectangle *sr = verts++;
-                DFBRectangle *dr = verts;
-
-                dr->x += clip_region.x1;
-                dr->y += clip_region.y1;
 
                 if (texturedata->display) {
+                    /* The video layer only shows one rect, the last one wins */
+                    DFBRectangle *sr = &verts[(count - 1) * 2];
+                    DFBRectangle *dr = &verts[(count - 1) * 2 + 1];
                     int px, py;
                     SDL_Window *window = renderer->window;
                     IDirectFBWindow *dfbwin = get_dfb_window(window);
@@ -778,7 +806,7 @@ DirectFB_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *
                     dfbwin->GetPosition(dfbwin, &px, &py);
                     px += windata->client.x;
                     py += windata->client.y;
-                    dispdata->vidlayer->SetScreenRectangle(dispdata->vidlayer, px + dr->x, py + dr->y, dr->w, dr->h);
+                    dispdata->vidlayer->SetScreenRectangle(dispdata->vidlayer, px + clip_region.x1 + dr->x, py + clip_region.y1 + dr->y, dr->w, dr->h);
                 } else {
                     DFBSurfaceBlittingFlags flags = 0;
                     if (texturedata->isDirty) {
@@ -806,10 +834,18 @@ DirectFB_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *
                     destsurf->SetRenderOptions(destsurf, texturedata->render_options);
 #endif
 
-                    if (sr->w == dr->w && sr->h == dr->h) {
-                        destsurf->Blit(destsurf, texturedata->surface, sr, dr->x, dr->y);
-                    } else {
-                        destsurf->StretchBlit(destsurf, texturedata->surface, sr, dr);
+                    for (i = 0; i < count; ++i, verts += 2) {
+                        DFBRectangle *sr = &verts[0];
+                        DFBRectangle *dr = &verts[1];
+
+                        dr->x += clip_region.x1;
+                        dr->y += clip_region.y1;
+
+                        if (sr->w == dr->w && sr->h == dr->h) {
+                            destsurf->Blit(destsurf, texturedata->surface, sr, dr->x, dr->y);
+                        } else {
+                            destsurf->StretchBlit(destsurf, texturedata->surface, sr, dr);
+                        }
                     }
                 }
                 break;
@@ -988,6 +1024,7 @@ DirectFB_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueFillRects = DirectFB_QueueFillRects;
     renderer->QueueCopy = DirectFB_QueueCopy;
     renderer->QueueCopyEx = DirectFB_QueueCopyEx;
+    renderer->QueueCopyBatch = DirectFB_QueueCopyBatch;
     renderer->RunCommandQueue = DirectFB_RunCommandQueue;
     renderer->RenderPresent = DirectFB_RenderPresent;
 
@@ -85,6 +85,57 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+# Where the channels of each format sit relative to B, G, R, A byte order,
+# which is the order the SIMD blitters work in
+my %simd_layout = (
+    "RGB888" => [],
+    "BGR888" => [ "SWAP" ],
+    "ARGB8888" => [ "ALPHA" ],
+    "RGBA8888" => [ "ROTATE", "ALPHA" ],
+    "ABGR8888" => [ "SWAP", "ALPHA" ],
+    "BGRA8888" => [ "ROTATE", "SWAP", "ALPHA" ],
+);
+
+my @simd_isas = ( "AVX2", "SSE2" );
+
+my %simd_guard = (
+    "SSE2" => "HAVE_SSE2_INTRINSICS",
+    "AVX2" => "SDL_AVX2_INTRINSICS",
+);
+
+my %simd_target = (
+    "SSE2" => "",
+    "AVX2" => "SDL_TARGETING(\"avx2\") ",
+);
+
+my %simd_pixels = (
+    "SSE2" => 4,
+    "AVX2" => 8,
+);
+
+# Loads the pixels at src[(posx + i * incx) >> 16] for a scaled row
+my %simd_gather = (
+    "SSE2" => <<'__EOF__',
+SDL_FORCE_INLINE __m128i
+SDL_Blit_Gather_SSE2(const Uint32 *src, int posx, int incx)
+{
+    return _mm_setr_epi32(src[posx >> 16], src[(posx + incx) >> 16],
+                          src[(posx + 2 * incx) >> 16], src[(posx + 3 * incx) >> 16]);
+}
+
+__EOF__
+    "AVX2" => <<'__EOF__',
+SDL_FORCE_INLINE SDL_TARGETING("avx2") __m256i
+SDL_Blit_Gather_AVX2(const Uint32 *src, int posx, int incx)
+{
+    const __m256i pos = _mm256_add_epi32(_mm256_set1_epi32(posx),
+                                         _mm256_mullo_epi32(_mm256_set1_epi32(incx), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    return _mm256_i32gather_epi32((const int *)src, _mm256_srli_epi32(pos, 16), 4);
+}
+
+__EOF__
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -153,6 +204,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $isa = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -164,6 +216,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $isa ) {
+        print FILE "_$isa";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -528,10 +583,294 @@ sub output_copyinc
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
+#include "SDL_cpuinfo.h"
+
+#ifdef __SSE2__
+#define HAVE_SSE2_INTRINSICS 1
+#endif
 
 __EOF__
 }
 
+sub get_simd_layout
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my @flags;
+
+    if ( $src eq $dst && !$modulate && !$blend ) {
+        push(@flags, "COPY");
+    } else {
+        foreach my $flag (@{$simd_layout{$src}}) {
+            push(@flags, "SRC_$flag");
+        }
+        foreach my $flag (@{$simd_layout{$dst}}) {
+            die "Can't rotate into $dst" if ( $flag eq "ROTATE" );
+            push(@flags, "DST_$flag");
+        }
+    }
+    if ( $modulate ) {
+        push(@flags, "MODULATE");
+    }
+    if ( $blend ) {
+        push(@flags, "BLEND");
+    }
+    if ( $scale ) {
+        push(@flags, "SCALE");
+    }
+    if ( !@flags ) {
+        return "0";
+    }
+    return join(" | ", map { "SDL_BLIT_SIMD_$_" } @flags);
+}
+
+sub output_simdkernel
+{
+    my $isa = shift;
+    my $kernel = <<'__EOF__';
+/* Exact x / 255 for 0 <= x <= 255 * 255 */
+SDL_FORCE_INLINE SIMD_TARGET__m128i
+SDL_Blit_Div255_SSE2(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE SIMD_TARGET__m128i
+SDL_Blit_SwapRB_SSE2(__m128i p)
+{
+    const __m128i rb = _mm_and_si128(p, _mm_set1_epi32(0x00FF00FF));
+    return _mm_or_si128(_mm_and_si128(p, _mm_set1_epi32(0xFF00FF00)),
+                        _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16)));
+}
+
+/* Blends unpacked source and destination pixels, both in B, G, R, A lane order */
+SDL_FORCE_INLINE SIMD_TARGET__m128i
+SDL_Blit_Blend_SSE2(__m128i s, __m128i d, const int mode, const int layout)
+{
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i alphamask = _mm_unpacklo_epi8(_mm_set1_epi32(0xFF000000), _mm_set1_epi32(0xFF000000));
+    const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i k, ge;
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_ADD:
+        /* This goes away if we ever use premultiplied alpha */
+        s = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(s, _mm_or_si128(_mm_andnot_si128(alphamask, a), _mm_and_si128(alphamask, ff))));
+        if (mode == SDL_COPY_BLEND) {
+            return _mm_add_epi16(s, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(_mm_sub_epi16(ff, a), d)));
+        }
+        return _mm_or_si128(_mm_andnot_si128(alphamask, _mm_min_epi16(_mm_add_epi16(s, d), ff)), _mm_and_si128(alphamask, d));
+    case SDL_COPY_MOD:
+        return _mm_or_si128(_mm_andnot_si128(alphamask, SDL_Blit_Div255_SSE2(_mm_mullo_epi16(s, d))), _mm_and_si128(alphamask, d));
+    case SDL_COPY_MUL:
+        /* (s * d + d * (255 - a)) / 255 can overflow 16 bits, so split off a whole d when the factor is 255 or more */
+        k = _mm_add_epi16(s, _mm_sub_epi16(ff, a));
+        ge = _mm_cmpgt_epi16(k, _mm_set1_epi16(254));
+        k = _mm_sub_epi16(k, _mm_and_si128(ge, ff));
+        d = _mm_min_epi16(_mm_add_epi16(SDL_Blit_Div255_SSE2(_mm_mullo_epi16(d, k)), _mm_and_si128(ge, d)), ff);
+        if (!(layout & (SDL_BLIT_SIMD_SRC_ALPHA | SDL_BLIT_SIMD_MODULATE))) {
+            d = _mm_or_si128(d, _mm_and_si128(alphamask, ff));
+        }
+        return d;
+    default:
+        return d;
+    }
+}
+
+SDL_FORCE_INLINE SIMD_TARGETvoid
+SDL_Blit_SSE2(SDL_BlitInfo *info, const int layout)
+{
+    const int flags = info->flags;
+    const int mode = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    const Uint32 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const Uint32 modulateRGB = (flags & SDL_COPY_MODULATE_COLOR) ? ((info->r << 16) | (info->g << 8) | info->b) : 0xFFFFFF;
+    const Uint32 modulate = (((layout & SDL_BLIT_SIMD_SRC_ALPHA) ? modulateA : 0xFF) << 24) | modulateRGB;
+    const SDL_bool do_modulate = (layout & SDL_BLIT_SIMD_MODULATE) && modulate != 0xFFFFFFFF;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mod16 = _mm_unpacklo_epi8(_mm_set1_epi32(modulate), zero);
+    const __m128i srcA = _mm_set1_epi32(((layout & SDL_BLIT_SIMD_MODULATE) ? modulateA : 0xFF) << 24);
+    const __m128i dstmask = _mm_set1_epi32((layout & SDL_BLIT_SIMD_DST_ALPHA) ? 0xFFFFFFFF : 0x00FFFFFF);
+    int srcy = 0, posy = 0;
+    int incx = 0, incy = 0;
+
+    if (layout & SDL_BLIT_SIMD_SCALE) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        if (layout & SDL_BLIT_SIMD_SCALE) {
+            while (posy >= 0x10000L) {
+                ++srcy;
+                posy -= 0x10000L;
+            }
+            src = (const Uint32 *)(info->src + (srcy * info->src_pitch));
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+
+        for (; n > 0; n -= SDL_BLIT_SSE2_PIXELS, dst += SDL_BLIT_SSE2_PIXELS) {
+            Uint32 buf[SDL_BLIT_SSE2_PIXELS];
+            const int count = SDL_min(n, SDL_BLIT_SSE2_PIXELS);
+            __m128i s, d, lo, hi;
+            int i;
+
+            if (count < SDL_BLIT_SSE2_PIXELS) {
+                SDL_zeroa(buf);
+            }
+            if (layout & SDL_BLIT_SIMD_SCALE) {
+                if (count < SDL_BLIT_SSE2_PIXELS) {
+                    for (i = 0; i < count; ++i) {
+                        buf[i] = src[posx >> 16];
+                        posx += incx;
+                    }
+                    s = _mm_loadu_si128((const __m128i *)buf);
+                } else {
+                    s = SDL_Blit_Gather_SSE2(src, posx, incx);
+                    posx += SDL_BLIT_SSE2_PIXELS * incx;
+                }
+            } else {
+                if (count < SDL_BLIT_SSE2_PIXELS) {
+                    SDL_memcpy(buf, src, count * sizeof (Uint32));
+                    s = _mm_loadu_si128((const __m128i *)buf);
+                } else {
+                    s = _mm_loadu_si128((const __m128i *)src);
+                }
+                src += SDL_BLIT_SSE2_PIXELS;
+            }
+
+            if (!(layout & SDL_BLIT_SIMD_COPY)) {
+                /* Put the source in B, G, R, A order */
+                if (layout & SDL_BLIT_SIMD_SRC_ROTATE) {
+                    s = _mm_or_si128(_mm_srli_epi32(s, 8), _mm_slli_epi32(s, 24));
+                }
+                if (layout & SDL_BLIT_SIMD_SRC_SWAP) {
+                    s = SDL_Blit_SwapRB_SSE2(s);
+                }
+                if (!(layout & SDL_BLIT_SIMD_SRC_ALPHA)) {
+                    s = _mm_or_si128(_mm_and_si128(s, _mm_set1_epi32(0x00FFFFFF)), srcA);
+                }
+                lo = _mm_unpacklo_epi8(s, zero);
+                hi = _mm_unpackhi_epi8(s, zero);
+
+                if (do_modulate) {
+                    lo = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(lo, mod16));
+                    hi = SDL_Blit_Div255_SSE2(_mm_mullo_epi16(hi, mod16));
+                }
+
+                if (layout & SDL_BLIT_SIMD_BLEND) {
+                    if (count < SDL_BLIT_SSE2_PIXELS) {
+                        SDL_memcpy(buf, dst, count * sizeof (Uint32));
+                        d = _mm_loadu_si128((const __m128i *)buf);
+                    } else {
+                        d = _mm_loadu_si128((const __m128i *)dst);
+                    }
+                    if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                        d = SDL_Blit_SwapRB_SSE2(d);
+                    }
+                    lo = SDL_Blit_Blend_SSE2(lo, _mm_unpacklo_epi8(d, zero), mode, layout);
+                    hi = SDL_Blit_Blend_SSE2(hi, _mm_unpackhi_epi8(d, zero), mode, layout);
+                }
+
+                s = _mm_packus_epi16(lo, hi);
+                if (layout & SDL_BLIT_SIMD_DST_SWAP) {
+                    s = SDL_Blit_SwapRB_SSE2(s);
+                }
+                s = _mm_and_si128(s, dstmask);
+            }
+
+            if (count < SDL_BLIT_SSE2_PIXELS) {
+                _mm_storeu_si128((__m128i *)buf, s);
+                SDL_memcpy(dst, buf, count * sizeof (Uint32));
+            } else {
+                _mm_storeu_si128((__m128i *)dst, s);
+            }
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+
+    # The kernel is written for SSE2, the wider versions only differ in vector size
+    if ( $isa ne "SSE2" ) {
+        my $bits = 32 * $simd_pixels{$isa};
+        $kernel =~ s/__m128i/__m${bits}i/g;
+        $kernel =~ s/_mm_/_mm${bits}_/g;
+        $kernel =~ s/si128/si${bits}/g;
+        $kernel =~ s/SSE2/$isa/g;
+    }
+    $kernel =~ s/SIMD_TARGET/$simd_target{$isa}/g;
+    print FILE $simd_gather{$isa};
+    print FILE $kernel;
+}
+
+sub output_simdfuncs
+{
+    print FILE <<__EOF__;
+#if HAVE_SSE2_INTRINSICS || SDL_AVX2_INTRINSICS
+/* How the SIMD blitters get from a source to a destination pixel */
+#define SDL_BLIT_SIMD_SRC_ROTATE    0x0001  /* source alpha is in the low byte */
+#define SDL_BLIT_SIMD_SRC_SWAP      0x0002  /* source red and blue are swapped */
+#define SDL_BLIT_SIMD_SRC_ALPHA     0x0004  /* source has alpha */
+#define SDL_BLIT_SIMD_DST_SWAP      0x0008  /* destination red and blue are swapped */
+#define SDL_BLIT_SIMD_DST_ALPHA     0x0010  /* destination has alpha */
+#define SDL_BLIT_SIMD_MODULATE      0x0020
+#define SDL_BLIT_SIMD_BLEND         0x0040
+#define SDL_BLIT_SIMD_SCALE         0x0080
+#define SDL_BLIT_SIMD_COPY          0x0100  /* same format, pixels are copied untouched */
+#endif
+
+__EOF__
+    foreach my $isa (reverse @simd_isas) {
+        print FILE <<__EOF__;
+#if $simd_guard{$isa}
+
+#define SDL_BLIT_${isa}_PIXELS $simd_pixels{$isa}
+
+__EOF__
+        output_simdkernel($isa);
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                my $layout = get_simd_layout($src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale);
+                                my $prefix = "static void $simd_target{$isa}";
+                                $prefix =~ s/\s+$//;
+                                output_copyfuncname($prefix, $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 1, "\n", $isa);
+                                $layout =~ s/ \| / |\n                  /g if ( length($layout) > 60 );
+                                print FILE <<__EOF__;
+{
+    SDL_Blit_${isa}(info, $layout);
+}
+
+__EOF__
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE <<__EOF__;
+#endif /* $simd_guard{$isa} */
+
+__EOF__
+    }
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -545,7 +884,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -575,6 +913,13 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
+                            foreach my $isa (@simd_isas) {
+                                print FILE "#if $simd_guard{$isa}\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_$isa,";
+                                output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $isa);
+                                print FILE "#endif\n";
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -623,5 +968,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");